@@ -16,6 +16,11 @@ graph_t *graph_create(void)
 
 	graph->nb_vertices = 0;
 	graph->vertices = NULL;
+	graph->last_vertex = NULL;
+	graph->buckets = NULL;
+	graph->nb_buckets = 0;
+	graph->vertex_array = NULL;
+	graph->vertex_array_size = 0;
 
 	return (graph);
 
@@ -12,25 +12,17 @@ vertex_t *create_vertex(const char *str);
  */
 vertex_t *graph_add_vertex(graph_t *graph, const char *str)
 {
-	vertex_t *vertex_ptr, *prev_vertex_ptr, *vertex;
+	vertex_t *vertex;
 
 	if (graph == NULL || str == NULL)
 	{
 		return (NULL);
 	}
 
-	vertex_ptr = graph->vertices;
-
 	/* Check if the vertex with the str already exists */
-	while (vertex_ptr)
+	if (graph_get_vertex(graph, str) != NULL)
 	{
-		if (strcmp(vertex_ptr->content, str) == 0)
-		{
-			return (NULL);
-		}
-
-		prev_vertex_ptr = vertex_ptr;
-		vertex_ptr = vertex_ptr->next;
+		return (NULL);
 	}
 
 	/*Create a new vertex*/
@@ -41,18 +33,21 @@ vertex_t *graph_add_vertex(graph_t *graph, const char *str)
 		return (NULL);
 	}
 
-
-	if (graph->nb_vertices == 0)
+	if (!graph_array_append(graph, vertex) ||
+	    !graph_index_insert(graph, vertex))
 	{
-		graph->vertices = vertex;
-		vertex->index = 0;
+		free(vertex->content);
+		free(vertex);
+		return (NULL);
 	}
+
+	if (graph->last_vertex == NULL)
+		graph->vertices = vertex;
 	else
-	{
-		prev_vertex_ptr->next = vertex;
-		vertex->index = prev_vertex_ptr->index + 1;
-	}
+		graph->last_vertex->next = vertex;
 
+	vertex->index = graph->nb_vertices;
+	graph->last_vertex = vertex;
 
 	graph->nb_vertices += 1;
 
@@ -62,7 +57,7 @@ vertex_t *graph_add_vertex(graph_t *graph, const char *str)
 /**
  * create_vertex - create a new vertex
  * @str: string value for the new vertex
- * Return: a pointer to the new vertex
+ * Return: a pointer to the new vertex, or NULL on failure
  */
 vertex_t *create_vertex(const char *str)
 {
@@ -74,10 +69,19 @@ vertex_t *create_vertex(const char *str)
 	}
 
 	vertex->content = strdup(str);
+
+	if (vertex->content == NULL)
+	{
+		free(vertex);
+		return (NULL);
+	}
+
 	vertex->index = 0;
 	vertex->edges = NULL;
+	vertex->last_edge = NULL;
 	vertex->nb_edges = 0;
 	vertex->next = NULL;
+	vertex->hash_next = NULL;
 
 	return (vertex);
 }
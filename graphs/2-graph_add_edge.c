@@ -9,7 +9,7 @@
 
 edge_t *graph_add_single_edge(vertex_t *src_vertex, vertex_t *dest_vertex)
 {
-	edge_t *new_edge = NULL, *temp_edge = NULL;
+	edge_t *new_edge = NULL;
 
 	if (!src_vertex || !dest_vertex)
 		return (NULL);
@@ -22,16 +22,13 @@ edge_t *graph_add_single_edge(vertex_t *src_vertex, vertex_t *dest_vertex)
 	new_edge->dest = dest_vertex;
 	new_edge->next = NULL;
 
-	temp_edge = src_vertex->edges;
-
-	while (temp_edge && temp_edge->next)
-		temp_edge = temp_edge->next;
-
-	if (temp_edge)
-		temp_edge->next = new_edge;
+	if (src_vertex->last_edge)
+		src_vertex->last_edge->next = new_edge;
 	else
 		src_vertex->edges = new_edge;
 
+	src_vertex->last_edge = new_edge;
+
 	src_vertex->nb_edges++;
 
 	return (new_edge);
@@ -51,22 +48,16 @@ edge_t *graph_add_single_edge(vertex_t *src_vertex, vertex_t *dest_vertex)
 int graph_add_edge(graph_t *graph, const char *src,
 		   const char *dest, edge_type_t type)
 {
-	vertex_t *temp_vertex = NULL, *src_vertex = NULL, *dest_vertex = NULL;
+	vertex_t *src_vertex = NULL, *dest_vertex = NULL;
 
 	if (!graph || !src || !dest ||
 	    type < UNIDIRECTIONAL || type > BIDIRECTIONAL)
 		return (0);
 
-	for (temp_vertex = graph->vertices; temp_vertex; temp_vertex =
-		     temp_vertex->next)
-	{
-		if (strcmp(temp_vertex->content, src) == 0)
-			src_vertex = temp_vertex;
-		else if (strcmp(temp_vertex->content, dest) == 0)
-			dest_vertex = temp_vertex;
-	}
+	src_vertex = graph_get_vertex(graph, src);
+	dest_vertex = graph_get_vertex(graph, dest);
 
-	if (!src_vertex || !dest_vertex)
+	if (!src_vertex || !dest_vertex || src_vertex == dest_vertex)
 		return (0);
 
 	if (graph_add_single_edge(src_vertex, dest_vertex) == NULL)
@@ -36,5 +36,7 @@ void graph_delete(graph_t *graph)
 		current_vertex = next_vertex;
 	}
 
+	free(graph->buckets);
+	free(graph->vertex_array);
 	free(graph);
 }
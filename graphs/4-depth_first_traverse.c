@@ -1,47 +1,36 @@
 #include "graphs.h"
 
 /**
- * traverseVerticesRecursively - recursive function that travels through
- * vertices in a graph
- * @vertex: the starting vertex to traverse from
- * @visited_flags: an array indicating whether vertices have been visited
- * @current_depth: the current depth level in traversal
- * @vertex_action: a function to perform an action on each vertex
- * Return: the maximum depth reached during traversal
+ * dfs_push - program that pushes a vertex on a depth-first stack,
+ * doubling the stack when it is full
+ * @stack: the stack
+ * @vertex: the vertex to push, whose edges will be explored from the first
+ * Return: 1 on success, 0 on failure
  */
 
-size_t traverseVerticesRecursively(vertex_t *vertex, char *visited_flags,
-				   size_t current_depth, void (*vertex_action)
-				   (const vertex_t *v, size_t depth))
+int dfs_push(dfs_stack_t *stack, vertex_t *vertex)
 {
-	size_t current_depth_new = 0, max_depth = current_depth, flag = 0;
-	edge_t *edge_header = NULL;
+	dfs_frame_t *frames;
+	size_t capacity;
 
-	if (!vertex)
-		return (current_depth - 1);
-
-	edge_header = vertex->edges;
-
-	while (edge_header)
+	if (stack->size == stack->capacity)
 	{
-		if (visited_flags[edge_header->dest->index] == 0)
-		{
-			vertex_action(edge_header->dest, current_depth);
-			visited_flags[edge_header->dest->index] = 1;
-			current_depth_new = traverseVerticesRecursively
-				(edge_header->dest, visited_flags,
-				 current_depth + 1, vertex_action);
+		capacity = stack->capacity ? stack->capacity * 2 :
+			STACK_MIN_CAPACITY;
+		frames = realloc(stack->frames, sizeof(dfs_frame_t) * capacity);
 
-			if (current_depth_new > max_depth)
-				max_depth = current_depth_new;
-			flag = 1;
-		}
-		edge_header = edge_header->next;
+		if (!frames)
+			return (0);
+
+		stack->frames = frames;
+		stack->capacity = capacity;
 	}
-	if (flag)
-		return (max_depth);
 
-	return (max_depth - 1);
+	stack->frames[stack->size].vertex = vertex;
+	stack->frames[stack->size].edge = vertex->edges;
+	stack->size++;
+
+	return (1);
 }
 
 
@@ -49,37 +38,50 @@ size_t traverseVerticesRecursively(vertex_t *vertex, char *visited_flags,
 /**
  * depth_first_traverse - program that traverses a graph using
  * depth-first search
+ * The traversal runs on a heap-allocated stack of frames and marks
+ * visited vertices in a bitset, so neither the call stack nor the
+ * number of vertices limits it
  * @graph: the graph to traverse
  * @action: a function to perform an action on each vertex along with its depth
- * Return: the maximum depth reached during traversal
+ * Return: the maximum depth reached during traversal, or 0 on failure
  */
 
 size_t depth_first_traverse(const graph_t *graph,
 			    void (*action)(const vertex_t *v, size_t depth))
 {
-	vertex_t *current_vertex = NULL;
-	char visited_flags[2048] = {0};
-	size_t current_depth = 0, max_depth = 0;
+	dfs_stack_t stack = {NULL, 0, 0};
+	dfs_frame_t *top;
+	unsigned long *visited;
+	size_t max_depth = 0;
+	vertex_t *dest;
 
-	if (!graph || !action)
+	if (!graph || !action || !graph->vertices)
 		return (0);
-
-	current_vertex = graph->vertices;
-
-	while (current_vertex)
+	visited = bitset_create(graph->nb_vertices);
+	if (!visited || !dfs_push(&stack, graph->vertices))
+		return (free(visited), 0);
+	action(graph->vertices, 0), bitset_set(visited, graph->vertices->index);
+	while (stack.size)
 	{
-		if (visited_flags[current_vertex->index] == 0)
+		top = &stack.frames[stack.size - 1];
+		while (top->edge &&
+		       bitset_test(visited, top->edge->dest->index))
+			top->edge = top->edge->next;
+		if (!top->edge)
 		{
-			action(current_vertex, 0);
-			visited_flags[current_vertex->index] = 1;
-			current_depth = traverseVerticesRecursively
-				(current_vertex, visited_flags, 1, action);
-
-			if (current_depth > max_depth)
-				max_depth = current_depth;
+			stack.size--;
+			continue;
+		}
+		dest = top->edge->dest, top->edge = top->edge->next;
+		action(dest, stack.size), bitset_set(visited, dest->index);
+		if (stack.size > max_depth)
+			max_depth = stack.size;
+		if (!dfs_push(&stack, dest))
+		{
+			max_depth = 0;
+			break;
 		}
-		current_vertex = current_vertex->next;
-		break;
 	}
+	free(visited), free(stack.frames);
 	return (max_depth);
 }
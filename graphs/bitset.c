@@ -0,0 +1,59 @@
+#include "graphs.h"
+
+/**
+ * bitset_create - allocates a bitset with every bit cleared
+ * @nb_bits: number of bits in the set
+ * Return: a pointer to the bitset, or NULL on failure
+ */
+unsigned long *bitset_create(size_t nb_bits)
+{
+	return (calloc(nb_bits / BITS_PER_WORD + 1, sizeof(unsigned long)));
+}
+
+/**
+ * bitset_test - checks whether a bit of a bitset is set
+ * @set: the bitset
+ * @i: the index of the bit
+ * Return: 1 if the bit is set, 0 otherwise
+ */
+int bitset_test(const unsigned long *set, size_t i)
+{
+	return ((set[i / BITS_PER_WORD] >> (i % BITS_PER_WORD)) & 1);
+}
+
+/**
+ * bitset_set - sets a bit of a bitset
+ * @set: the bitset
+ * @i: the index of the bit
+ */
+void bitset_set(unsigned long *set, size_t i)
+{
+	set[i / BITS_PER_WORD] |= 1UL << (i % BITS_PER_WORD);
+}
+
+/**
+ * bitset_atomic_test - checks a bit of a bitset that other threads
+ * may be setting concurrently
+ * @set: the bitset
+ * @i: the index of the bit
+ * Return: 1 if the bit is set, 0 otherwise
+ */
+int bitset_atomic_test(const unsigned long *set, size_t i)
+{
+	return ((__atomic_load_n(&set[i / BITS_PER_WORD], __ATOMIC_RELAXED) >>
+		 (i % BITS_PER_WORD)) & 1);
+}
+
+/**
+ * bitset_atomic_set - atomically sets a bit of a bitset
+ * @set: the bitset
+ * @i: the index of the bit
+ * Return: 1 if this call set the bit, 0 if it was already set
+ */
+int bitset_atomic_set(unsigned long *set, size_t i)
+{
+	unsigned long mask = 1UL << (i % BITS_PER_WORD);
+
+	return (!(__atomic_fetch_or(&set[i / BITS_PER_WORD], mask,
+				    __ATOMIC_RELAXED) & mask));
+}
@@ -0,0 +1,91 @@
+#include "graphs.h"
+
+/**
+ * csr_depth_first_traverse - depth_first_traverse on a CSR snapshot
+ * The recursion is replaced by an explicit stack of (vertex, next edge)
+ * pairs, so the call stack does not grow with the depth of the graph
+ * @csr: the snapshot to traverse
+ * @action: a function to perform an action on each vertex along with its depth
+ * Return: the maximum depth reached during traversal
+ */
+size_t csr_depth_first_traverse(const csr_graph_t *csr,
+				void (*action)(const vertex_t *v, size_t depth))
+{
+	size_t *stack, *cursor, top = 0, max_depth = 0, dest;
+	char *visited;
+
+	if (!csr || !action || csr->nb_vertices == 0)
+		return (0);
+	visited = calloc(csr->nb_vertices, sizeof(char));
+	stack = malloc(sizeof(size_t) * csr->nb_vertices * 2);
+	if (!visited || !stack)
+	{
+		free(visited), free(stack);
+		return (0);
+	}
+	cursor = stack + csr->nb_vertices;
+	action(csr->vertices[0], 0), visited[0] = 1;
+	stack[0] = 0, cursor[0] = csr->offsets[0];
+	while (1)
+	{
+		while (cursor[top] < csr->offsets[stack[top] + 1] &&
+		       visited[csr->dests[cursor[top]]])
+			cursor[top]++;
+		if (cursor[top] < csr->offsets[stack[top] + 1])
+		{
+			dest = csr->dests[cursor[top]++];
+			action(csr->vertices[dest], ++top), visited[dest] = 1;
+			stack[top] = dest, cursor[top] = csr->offsets[dest];
+			if (top > max_depth)
+				max_depth = top;
+		}
+		else if (top-- == 0)
+			break;
+	}
+	free(visited), free(stack);
+	return (max_depth);
+}
+
+/**
+ * csr_breadth_first_traverse - breadth_first_traverse on a CSR snapshot
+ * Every vertex is queued at most once, so the queue is a plain array of
+ * nb_vertices indices, and a level ends where the previous one did
+ * @csr: the snapshot to traverse
+ * @action: a function to perform an action on each vertex along with its depth
+ * Return: the maximum depth reached during traversal
+ */
+size_t csr_breadth_first_traverse(const csr_graph_t *csr,
+				void (*action)(const vertex_t *v, size_t depth))
+{
+	size_t *queue, head = 0, tail = 1, level_end = 1, depth = 0, e;
+	char *visited;
+
+	if (!csr || !action || csr->nb_vertices == 0)
+		return (0);
+	visited = calloc(csr->nb_vertices, sizeof(char));
+	queue = malloc(sizeof(size_t) * csr->nb_vertices);
+	if (!visited || !queue)
+	{
+		free(visited), free(queue);
+		return (0);
+	}
+	queue[0] = 0, visited[0] = 1;
+	while (head < tail)
+	{
+		if (head == level_end)
+			depth++, level_end = tail;
+		action(csr->vertices[queue[head]], depth);
+		for (e = csr->offsets[queue[head]];
+		     e < csr->offsets[queue[head] + 1]; e++)
+		{
+			if (!visited[csr->dests[e]])
+			{
+				visited[csr->dests[e]] = 1;
+				queue[tail++] = csr->dests[e];
+			}
+		}
+		head++;
+	}
+	free(visited), free(queue);
+	return (depth);
+}
@@ -0,0 +1,123 @@
+#include "graphs.h"
+
+/**
+ * csr_graph_alloc - allocates the arrays of a CSR snapshot
+ * @nb_vertices: number of vertices
+ * @nb_edges: number of edges
+ * Return: a pointer to the snapshot, or NULL on failure
+ */
+csr_graph_t *csr_graph_alloc(size_t nb_vertices, size_t nb_edges)
+{
+	csr_graph_t *csr = malloc(sizeof(csr_graph_t));
+
+	if (!csr)
+		return (NULL);
+
+	csr->nb_vertices = nb_vertices;
+	csr->nb_edges = nb_edges;
+	csr->offsets = malloc(sizeof(size_t) * (nb_vertices + 1));
+	csr->dests = malloc(sizeof(size_t) * (nb_edges + 1));
+	csr->vertices = malloc(sizeof(vertex_t *) * (nb_vertices + 1));
+
+	if (!csr->offsets || !csr->dests || !csr->vertices)
+	{
+		csr_graph_delete(csr);
+		return (NULL);
+	}
+
+	return (csr);
+}
+
+/**
+ * csr_graph_delete - frees a CSR snapshot
+ * The graph it was built from is left untouched
+ * @csr: a pointer to the snapshot
+ */
+void csr_graph_delete(csr_graph_t *csr)
+{
+	if (!csr)
+		return;
+
+	free(csr->offsets);
+	free(csr->dests);
+	free(csr->vertices);
+	free(csr);
+}
+
+/**
+ * graph_freeze - builds an immutable CSR snapshot of a graph
+ * The edges of each vertex are stored contiguously, so traversals of the
+ * snapshot read memory sequentially instead of chasing list pointers.
+ * The snapshot does not follow later changes to the graph, and the
+ * vertices it points to still belong to the graph
+ * @graph: the graph to freeze
+ * Return: a pointer to the snapshot, or NULL on failure
+ */
+csr_graph_t *graph_freeze(const graph_t *graph)
+{
+	csr_graph_t *csr;
+	vertex_t *vertex;
+	edge_t *edge;
+	size_t nb_edges = 0, i, k = 0;
+
+	if (!graph)
+		return (NULL);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		nb_edges += vertex->nb_edges;
+
+	csr = csr_graph_alloc(graph->nb_vertices, nb_edges);
+
+	if (!csr)
+		return (NULL);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		csr->vertices[vertex->index] = vertex;
+
+	for (i = 0; i < csr->nb_vertices; i++)
+	{
+		csr->offsets[i] = k;
+
+		for (edge = csr->vertices[i]->edges; edge && k < nb_edges;
+		     edge = edge->next)
+			csr->dests[k++] = edge->dest->index;
+	}
+	csr->offsets[i] = k;
+	csr->nb_edges = k;
+
+	return (csr);
+}
+
+/**
+ * csr_transpose - builds the CSR snapshot of a graph with every edge
+ * reversed, listing the predecessors of each vertex
+ * @csr: the snapshot to transpose
+ * Return: a pointer to the transposed snapshot, or NULL on failure
+ */
+csr_graph_t *csr_transpose(const csr_graph_t *csr)
+{
+	csr_graph_t *rev;
+	size_t i, e, *fill;
+
+	rev = csr_graph_alloc(csr->nb_vertices, csr->nb_edges);
+	fill = calloc(csr->nb_vertices + 1, sizeof(size_t));
+	if (!rev || !fill)
+	{
+		csr_graph_delete(rev), free(fill);
+		return (NULL);
+	}
+	memcpy(rev->vertices, csr->vertices,
+	       sizeof(vertex_t *) * csr->nb_vertices);
+	for (e = 0; e < csr->nb_edges; e++)
+		fill[csr->dests[e] + 1]++;
+	for (i = 0; i < csr->nb_vertices; i++)
+		fill[i + 1] += fill[i];
+	memcpy(rev->offsets, fill, sizeof(size_t) * (csr->nb_vertices + 1));
+	for (i = 0; i < csr->nb_vertices; i++)
+	{
+		for (e = csr->offsets[i]; e < csr->offsets[i + 1]; e++)
+			rev->dests[fill[csr->dests[e]]++] = i;
+	}
+	free(fill);
+	return (rev);
+}
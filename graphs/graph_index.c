@@ -0,0 +1,129 @@
+#include "graphs.h"
+
+/**
+ * graph_hash - computes the FNV-1a hash of a string
+ * @str: the string to hash
+ * Return: the hash value
+ */
+size_t graph_hash(const char *str)
+{
+	size_t hash = 2166136261u;
+
+	while (*str)
+	{
+		hash ^= (unsigned char)*str++;
+		hash *= 16777619u;
+	}
+
+	return (hash);
+}
+
+/**
+ * graph_get_vertex - finds a vertex by its content in the graph's index
+ * @graph: the graph to search
+ * @str: the content of the vertex to find
+ * Return: a pointer to the vertex, or NULL if there is none
+ */
+vertex_t *graph_get_vertex(const graph_t *graph, const char *str)
+{
+	vertex_t *vertex;
+
+	if (!graph || !str || graph->nb_buckets == 0)
+		return (NULL);
+
+	vertex = graph->buckets[graph_hash(str) & (graph->nb_buckets - 1)];
+
+	while (vertex && strcmp(vertex->content, str) != 0)
+		vertex = vertex->hash_next;
+
+	return (vertex);
+}
+
+/**
+ * graph_index_grow - doubles the number of buckets of the graph's index
+ * and moves every vertex to its new bucket
+ * @graph: the graph whose index grows
+ * Return: 1 on success, 0 on failure
+ */
+int graph_index_grow(graph_t *graph)
+{
+	vertex_t **buckets, *vertex, *next;
+	size_t nb_buckets, i, slot;
+
+	nb_buckets = graph->nb_buckets ? graph->nb_buckets * 2 :
+		GRAPH_INDEX_MIN_BUCKETS;
+	buckets = calloc(nb_buckets, sizeof(*buckets));
+
+	if (!buckets)
+		return (0);
+
+	for (i = 0; i < graph->nb_buckets; i++)
+	{
+		for (vertex = graph->buckets[i]; vertex; vertex = next)
+		{
+			next = vertex->hash_next;
+			slot = graph_hash(vertex->content) & (nb_buckets - 1);
+			vertex->hash_next = buckets[slot];
+			buckets[slot] = vertex;
+		}
+	}
+
+	free(graph->buckets);
+	graph->buckets = buckets;
+	graph->nb_buckets = nb_buckets;
+
+	return (1);
+}
+
+/**
+ * graph_index_insert - adds a vertex to the graph's index
+ * The index grows once there are as many vertices as buckets, so
+ * lookups stay O(1) on average
+ * @graph: the graph to which the vertex belongs
+ * @vertex: the vertex to add
+ * Return: 1 on success, 0 on failure
+ */
+int graph_index_insert(graph_t *graph, vertex_t *vertex)
+{
+	size_t slot;
+
+	if (graph->nb_vertices >= graph->nb_buckets &&
+	    !graph_index_grow(graph) && graph->nb_buckets == 0)
+		return (0);
+
+	slot = graph_hash(vertex->content) & (graph->nb_buckets - 1);
+	vertex->hash_next = graph->buckets[slot];
+	graph->buckets[slot] = vertex;
+
+	return (1);
+}
+
+/**
+ * graph_array_append - stores a new vertex at the end of the graph's
+ * index-to-vertex array, doubling the array when it is full
+ * @graph: the graph to which the vertex belongs
+ * @vertex: the vertex to store, whose index is graph->nb_vertices
+ * Return: 1 on success, 0 on failure
+ */
+int graph_array_append(graph_t *graph, vertex_t *vertex)
+{
+	vertex_t **array;
+	size_t size;
+
+	if (graph->nb_vertices == graph->vertex_array_size)
+	{
+		size = graph->vertex_array_size ? graph->vertex_array_size * 2 :
+			GRAPH_INDEX_MIN_BUCKETS;
+		array = realloc(graph->vertex_array, sizeof(*array) * size);
+
+		if (!array)
+			return (0);
+
+		graph->vertex_array = array;
+		graph->vertex_array_size = size;
+	}
+
+	graph->vertex_array[graph->nb_vertices] = vertex;
+
+	return (1);
+}
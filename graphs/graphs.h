@@ -4,13 +4,19 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <pthread.h>
 
 
 #define  UNEXPLORED 0
 #define  EXPLORED 1
 #define BACKTRACK 2
-#define SIZE 65536
-#define LEVELBREAK -60
+#define QUEUE_MIN_CAPACITY 64
+#define STACK_MIN_CAPACITY 64
+#define BITS_PER_WORD (sizeof(unsigned long) * 8)
+#define PBFS_UNREACHED ((size_t)-1)
+#define PBFS_ALPHA 14
+#define PBFS_BETA 24
+#define GRAPH_INDEX_MIN_BUCKETS 64
 
 /**
 * enum edge_type_e - Enumerates the different types of
@@ -50,9 +56,12 @@ typedef struct edge_s
 * @content: Custom data stored in the vertex (here, a string)
 * @nb_edges: Number of connections with other vertices in the graph
 * @edges: Pointer to the head node of the linked list of edges
+* @last_edge: Pointer to the tail node of the linked list of edges
 * @next: Pointer to the next vertex in the adjacency linked list
 *   This pointer points to another vertex in the graph, but it
 *   doesn't stand for an edge between the two vertices
+* @hash_next: Pointer to the next vertex in the same bucket of the
+*   graph's content index
 */
 struct vertex_s
 {
@@ -61,7 +70,9 @@ struct vertex_s
 
 	size_t      nb_edges;
 	edge_t      *edges;
+	edge_t      *last_edge;
 	struct vertex_s *next;
+	struct vertex_s *hash_next;
 };
 
 /**
@@ -70,13 +81,136 @@ struct vertex_s
 *
 * @nb_vertices: Number of vertices in our graph
 * @vertices: Pointer to the head node of our adjacency linked list
+* @last_vertex: Pointer to the tail node of our adjacency linked list
+* @buckets: Hash table of the vertices keyed by content, each bucket
+*   being a list chained through vertex_t.hash_next
+* @nb_buckets: Number of buckets in @buckets (a power of two)
+* @vertex_array: Array of the vertices, where @vertex_array[i] is the
+*   vertex of index i
+* @vertex_array_size: Number of slots allocated in @vertex_array
 */
 typedef struct graph_s
 {
 	size_t      nb_vertices;
 	vertex_t    *vertices;
+	vertex_t    *last_vertex;
+	vertex_t    **buckets;
+	size_t      nb_buckets;
+	vertex_t    **vertex_array;
+	size_t      vertex_array_size;
 } graph_t;
 
+/**
+* struct dfs_frame_s - Frame of the explicit stack of depth_first_traverse
+*
+* @vertex: Vertex being explored
+* @edge: Next edge of @vertex to follow
+*/
+typedef struct dfs_frame_s
+{
+	vertex_t    *vertex;
+	edge_t      *edge;
+} dfs_frame_t;
+
+/**
+* struct dfs_stack_s - Growable stack of dfs_frame_t
+*
+* @frames: Array of frames, @frames[0] being the bottom of the stack
+* @size: Number of frames in the stack
+* @capacity: Number of frames allocated in @frames
+*/
+typedef struct dfs_stack_s
+{
+	dfs_frame_t *frames;
+	size_t      size;
+	size_t      capacity;
+} dfs_stack_t;
+
+/**
+* struct csr_graph_s - Frozen compressed sparse row form of a graph
+* The edges of the vertex of index i are the entries @offsets[i] to
+* @offsets[i + 1] - 1 of @dests, in the order of its edge list
+*
+* @nb_vertices: Number of vertices
+* @nb_edges: Number of edges
+* @offsets: First edge of each vertex, followed by @nb_edges
+* @dests: Index of the destination vertex of each edge
+* @vertices: Vertex of each index in the graph the snapshot was built from
+*/
+typedef struct csr_graph_s
+{
+	size_t      nb_vertices;
+	size_t      nb_edges;
+	size_t      *offsets;
+	size_t      *dests;
+	vertex_t    **vertices;
+} csr_graph_t;
+
+typedef struct pbfs_s pbfs_t;
+
+/**
+* struct pbfs_worker_s - Per-thread state of a parallel breadth-first search
+*
+* @bfs: Shared state of the search
+* @id: Number of the thread, 0 being the calling thread
+* @thread: Handle of the thread
+* @nb_found: Number of vertices this thread reached in the current level
+* @nb_edges: Number of edges leaving those vertices
+*/
+typedef struct pbfs_worker_s
+{
+	pbfs_t      *bfs;
+	size_t      id;
+	pthread_t   thread;
+	size_t      nb_found;
+	size_t      nb_edges;
+} pbfs_worker_t;
+
+/**
+* struct pbfs_s - Shared state of a parallel breadth-first search
+* Each level is expanded either top-down (the frontier pushes to its
+* successors) or bottom-up (unreached vertices look for a predecessor in
+* the frontier), whichever touches fewer edges
+*
+* @csr: Snapshot being traversed
+* @rev: Transposed snapshot for bottom-up levels, NULL to stay top-down
+* @depths: Depth of each vertex, PBFS_UNREACHED until it is reached
+* @visited: Bitset of the reached vertices
+* @frontier: Bitset of the vertices of the current level
+* @next: Bitset of the vertices of the next level
+* @nb_words: Number of words in each bitset
+* @level: Depth of the current level
+* @bottom_up: Whether the current level is expanded bottom-up
+* @done: Whether the search is over
+* @unexplored_edges: Number of edges leaving unreached vertices
+* @nb_threads: Number of threads taking part in the search
+* @workers: Per-thread state, @nb_threads entries
+* @barrier: Barrier separating two levels
+* @lock: Mutex protecting @started
+* @start: Condition signaled once every thread is created
+* @started: Whether the threads may start
+*/
+struct pbfs_s
+{
+	const csr_graph_t *csr;
+	const csr_graph_t *rev;
+	size_t      *depths;
+	unsigned long *visited;
+	unsigned long *frontier;
+	unsigned long *next;
+	size_t      nb_words;
+	size_t      level;
+	int         bottom_up;
+	int         done;
+	size_t      unexplored_edges;
+	size_t      nb_threads;
+	pbfs_worker_t *workers;
+	pthread_barrier_t barrier;
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	int         started;
+};
+
 /**
 * struct queue_node_s - queue node data structure
 * @vertex: pointer to vertex type
@@ -100,17 +234,19 @@ typedef struct queue_node_s
 */
 
 /**
- * struct queue_s - Representation of a queue
+ * struct queue_s - Growable circular queue of vertex indices
  *
- * @items: items to be queued
- * @front: Pointer to the first item in queue
- * @rear: Pointer to the last item in queue
+ * @items: Circular buffer holding the queued indices
+ * @capacity: Number of slots in @items (a power of two)
+ * @front: Slot of the first index in queue
+ * @count: Number of indices in queue
  */
 typedef struct queue_s
 {
-	int items[SIZE];
-	int front;
-	int rear;
+	size_t *items;
+	size_t capacity;
+	size_t front;
+	size_t count;
 
 } queue_t;
 
@@ -120,6 +256,12 @@ void queue_push_front(queue_t *queue, vertex_t *vertex);
 void queue_push_back(queue_t *queue, vertex_t *vertex);
 vertex_t *queue_pop_front(queue_t *queue);
 
+queue_t *createqueue_t(void);
+void deletequeue_t(queue_t *q);
+int growqueue_t(queue_t *q);
+int enqueue(queue_t *q, size_t value);
+size_t dequeue(queue_t *q);
+
 
 graph_t *graph_create(void);
 vertex_t *graph_add_vertex(graph_t *graph, const char *str);
@@ -128,9 +270,46 @@ int graph_add_edge
 (graph_t *graph, const char *src, const char *dest, edge_type_t type);
 
 void graph_delete(graph_t *graph);
+
+size_t graph_hash(const char *str);
+vertex_t *graph_get_vertex(const graph_t *graph, const char *str);
+int graph_index_grow(graph_t *graph);
+int graph_index_insert(graph_t *graph, vertex_t *vertex);
+int graph_array_append(graph_t *graph, vertex_t *vertex);
+vertex_t *get_vertex_index(const graph_t *graph, size_t index);
 size_t depth_first_traverse(const graph_t *graph,
 void (*action)(const vertex_t *v, size_t depth));
 size_t breadth_first_traverse(const graph_t *graph,
 void (*action)(const vertex_t *v, size_t depth));
 
+unsigned long *bitset_create(size_t nb_bits);
+int bitset_test(const unsigned long *set, size_t i);
+void bitset_set(unsigned long *set, size_t i);
+int bitset_atomic_test(const unsigned long *set, size_t i);
+int bitset_atomic_set(unsigned long *set, size_t i);
+int dfs_push(dfs_stack_t *stack, vertex_t *vertex);
+
+csr_graph_t *csr_graph_alloc(size_t nb_vertices, size_t nb_edges);
+void csr_graph_delete(csr_graph_t *csr);
+csr_graph_t *graph_freeze(const graph_t *graph);
+csr_graph_t *csr_transpose(const csr_graph_t *csr);
+size_t csr_depth_first_traverse(const csr_graph_t *csr,
+void (*action)(const vertex_t *v, size_t depth));
+size_t csr_breadth_first_traverse(const csr_graph_t *csr,
+void (*action)(const vertex_t *v, size_t depth));
+
+void pbfs_top_down(pbfs_worker_t *worker);
+void pbfs_bottom_up(pbfs_worker_t *worker);
+void pbfs_next_level(pbfs_t *bfs);
+void *pbfs_worker(void *arg);
+pbfs_t *pbfs_create(const csr_graph_t *csr, const csr_graph_t *rev,
+size_t nb_threads);
+void pbfs_delete(pbfs_t *bfs);
+void pbfs_launch(pbfs_t *bfs);
+size_t *parallel_breadth_first_traverse(const csr_graph_t *csr,
+const csr_graph_t *rev, size_t source, size_t nb_threads,
+size_t *max_depth);
+void pbfs_visit(const csr_graph_t *csr, const size_t *depths,
+size_t max_depth, void (*action)(const vertex_t *v, size_t depth));
+
 #endif /*GRAPH_H*/
@@ -0,0 +1,134 @@
+#include "graphs.h"
+
+/**
+ * pbfs_top_down - expands the part of the frontier owned by a thread
+ * by pushing to the successors of its vertices
+ * A successor is claimed by whichever thread sets its visited bit first
+ * @worker: the state of the thread
+ */
+void pbfs_top_down(pbfs_worker_t *worker)
+{
+	pbfs_t *bfs = worker->bfs;
+	const csr_graph_t *csr = bfs->csr;
+	size_t word, u, e, v, hi;
+	unsigned long bits;
+
+	word = bfs->nb_words * worker->id / bfs->nb_threads;
+	hi = bfs->nb_words * (worker->id + 1) / bfs->nb_threads;
+	for (; word < hi; word++)
+	{
+		for (bits = bfs->frontier[word]; bits; bits &= bits - 1)
+		{
+			u = word * BITS_PER_WORD + __builtin_ctzl(bits);
+			for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+			{
+				v = csr->dests[e];
+				if (bitset_atomic_test(bfs->visited, v) ||
+				    !bitset_atomic_set(bfs->visited, v))
+					continue;
+				bfs->depths[v] = bfs->level + 1;
+				bitset_atomic_set(bfs->next, v);
+				worker->nb_found++;
+				worker->nb_edges += csr->offsets[v + 1] -
+					csr->offsets[v];
+			}
+		}
+	}
+}
+
+/**
+ * pbfs_bottom_up - lets every unreached vertex owned by a thread look
+ * for a predecessor in the frontier
+ * Each thread owns whole bitset words, so no vertex is claimed twice
+ * @worker: the state of the thread
+ */
+void pbfs_bottom_up(pbfs_worker_t *worker)
+{
+	pbfs_t *bfs = worker->bfs;
+	const csr_graph_t *rev = bfs->rev;
+	size_t v, e, hi;
+
+	v = bfs->nb_words * worker->id / bfs->nb_threads * BITS_PER_WORD;
+	hi = bfs->nb_words * (worker->id + 1) / bfs->nb_threads * BITS_PER_WORD;
+	if (hi > rev->nb_vertices)
+		hi = rev->nb_vertices;
+	for (; v < hi; v++)
+	{
+		if (bitset_atomic_test(bfs->visited, v))
+			continue;
+		for (e = rev->offsets[v]; e < rev->offsets[v + 1]; e++)
+		{
+			if (!bitset_test(bfs->frontier, rev->dests[e]))
+				continue;
+			bitset_atomic_set(bfs->visited, v);
+			bfs->depths[v] = bfs->level + 1;
+			bitset_atomic_set(bfs->next, v);
+			worker->nb_found++;
+			worker->nb_edges += bfs->csr->offsets[v + 1] -
+				bfs->csr->offsets[v];
+			break;
+		}
+	}
+}
+
+/**
+ * pbfs_next_level - moves a search to its next level and picks the
+ * direction to expand it in
+ * Bottom-up is chosen once the frontier's edges outweigh 1/PBFS_ALPHA of
+ * the unexplored ones, and top-down again once the frontier holds less
+ * than 1/PBFS_BETA of the vertices
+ * @bfs: the state of the search, with every thread stopped at the barrier
+ */
+void pbfs_next_level(pbfs_t *bfs)
+{
+	size_t i, nb_found = 0, nb_edges = 0;
+	unsigned long *swap;
+
+	for (i = 0; i < bfs->nb_threads; i++)
+	{
+		nb_found += bfs->workers[i].nb_found;
+		nb_edges += bfs->workers[i].nb_edges;
+		bfs->workers[i].nb_found = 0, bfs->workers[i].nb_edges = 0;
+	}
+	swap = bfs->frontier, bfs->frontier = bfs->next, bfs->next = swap;
+	memset(bfs->next, 0, sizeof(unsigned long) * bfs->nb_words);
+	bfs->unexplored_edges -= nb_edges;
+	bfs->level++;
+	if (nb_found == 0)
+		bfs->done = 1;
+	else if (!bfs->bottom_up)
+		bfs->bottom_up = bfs->rev &&
+			nb_edges > bfs->unexplored_edges / PBFS_ALPHA;
+	else
+		bfs->bottom_up = nb_found >= bfs->csr->nb_vertices / PBFS_BETA;
+}
+
+/**
+ * pbfs_worker - body of every thread of a parallel breadth-first search
+ * All the threads expand a level, then thread 0 prepares the next one
+ * while the others wait at the barrier
+ * @arg: the state of the thread (pbfs_worker_t *)
+ * Return: NULL
+ */
+void *pbfs_worker(void *arg)
+{
+	pbfs_worker_t *worker = arg;
+	pbfs_t *bfs = worker->bfs;
+
+	pthread_mutex_lock(&bfs->lock);
+	while (!bfs->started)
+		pthread_cond_wait(&bfs->start, &bfs->lock);
+	pthread_mutex_unlock(&bfs->lock);
+	while (!bfs->done)
+	{
+		if (bfs->bottom_up)
+			pbfs_bottom_up(worker);
+		else
+			pbfs_top_down(worker);
+		pthread_barrier_wait(&bfs->barrier);
+		if (worker->id == 0)
+			pbfs_next_level(bfs);
+		pthread_barrier_wait(&bfs->barrier);
+	}
+	return (NULL);
+}
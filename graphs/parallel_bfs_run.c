@@ -0,0 +1,120 @@
+#include "graphs.h"
+
+/**
+ * pbfs_create - allocates the state of a parallel breadth-first search
+ * @csr: the snapshot to traverse
+ * @rev: the transposed snapshot, or NULL
+ * @nb_threads: the number of threads to use
+ * Return: a pointer to the state, or NULL on failure
+ */
+pbfs_t *pbfs_create(const csr_graph_t *csr, const csr_graph_t *rev,
+		    size_t nb_threads)
+{
+	pbfs_t *bfs = calloc(1, sizeof(pbfs_t));
+	size_t i;
+
+	if (!bfs)
+		return (NULL);
+	bfs->csr = csr, bfs->rev = rev, bfs->nb_threads = nb_threads;
+	bfs->nb_words = csr->nb_vertices / BITS_PER_WORD + 1;
+	bfs->depths = malloc(sizeof(size_t) * (csr->nb_vertices + 1));
+	bfs->visited = bitset_create(csr->nb_vertices);
+	bfs->frontier = bitset_create(csr->nb_vertices);
+	bfs->next = bitset_create(csr->nb_vertices);
+	bfs->workers = calloc(nb_threads, sizeof(pbfs_worker_t));
+	if (!bfs->depths || !bfs->visited || !bfs->frontier || !bfs->next ||
+	    !bfs->workers)
+	{
+		free(bfs->depths);
+		pbfs_delete(bfs);
+		return (NULL);
+	}
+	for (i = 0; i < csr->nb_vertices; i++)
+		bfs->depths[i] = PBFS_UNREACHED;
+	for (i = 0; i < nb_threads; i++)
+		bfs->workers[i].bfs = bfs, bfs->workers[i].id = i;
+	bfs->unexplored_edges = csr->nb_edges;
+	pthread_mutex_init(&bfs->lock, NULL);
+	pthread_cond_init(&bfs->start, NULL);
+	return (bfs);
+}
+
+/**
+ * pbfs_delete - frees the state of a parallel breadth-first search,
+ * except for its depth array
+ * @bfs: a pointer to the state
+ */
+void pbfs_delete(pbfs_t *bfs)
+{
+	if (!bfs)
+		return;
+	free(bfs->visited), free(bfs->frontier), free(bfs->next);
+	free(bfs->workers);
+	free(bfs);
+}
+
+/**
+ * pbfs_launch - starts the threads of a parallel breadth-first search
+ * The threads wait until they are all created, so a failed creation
+ * only lowers the number of threads taking part
+ * @bfs: a pointer to the state
+ */
+void pbfs_launch(pbfs_t *bfs)
+{
+	size_t i;
+
+	for (i = 1; i < bfs->nb_threads; i++)
+	{
+		if (pthread_create(&bfs->workers[i].thread, NULL, pbfs_worker,
+				   &bfs->workers[i]) != 0)
+			break;
+	}
+	pthread_mutex_lock(&bfs->lock);
+	bfs->nb_threads = i;
+	pthread_barrier_init(&bfs->barrier, NULL, i);
+	bfs->started = 1;
+	pthread_cond_broadcast(&bfs->start);
+	pthread_mutex_unlock(&bfs->lock);
+}
+
+/**
+ * parallel_breadth_first_traverse - computes the depth of every vertex
+ * reachable from a source with a level-synchronous parallel BFS that
+ * switches between top-down and bottom-up expansion
+ * @csr: the snapshot to traverse
+ * @rev: the transposed snapshot (csr_transpose), or NULL to only expand
+ *   top-down; an undirected graph can pass @csr itself
+ * @source: the index of the source vertex
+ * @nb_threads: the number of threads to use, the caller being one of them
+ * @max_depth: where to store the maximum depth reached, or NULL
+ * Return: an array of nb_vertices depths (PBFS_UNREACHED for unreached
+ * vertices) to be freed by the caller, or NULL on failure
+ */
+size_t *parallel_breadth_first_traverse(const csr_graph_t *csr,
+					const csr_graph_t *rev, size_t source,
+					size_t nb_threads, size_t *max_depth)
+{
+	pbfs_t *bfs;
+	size_t *depths, i;
+
+	if (!csr || source >= csr->nb_vertices)
+		return (NULL);
+	bfs = pbfs_create(csr, rev, nb_threads ? nb_threads : 1);
+	if (!bfs)
+		return (NULL);
+	bfs->depths[source] = 0;
+	bitset_set(bfs->visited, source), bitset_set(bfs->frontier, source);
+	bfs->unexplored_edges -= csr->offsets[source + 1] -
+		csr->offsets[source];
+	pbfs_launch(bfs);
+	pbfs_worker(&bfs->workers[0]);
+	for (i = 1; i < bfs->nb_threads; i++)
+		pthread_join(bfs->workers[i].thread, NULL);
+	pthread_barrier_destroy(&bfs->barrier);
+	pthread_mutex_destroy(&bfs->lock), pthread_cond_destroy(&bfs->start);
+	if (max_depth)
+		*max_depth = bfs->level - 1;
+	depths = bfs->depths;
+	pbfs_delete(bfs);
+	return (depths);
+}
@@ -0,0 +1,43 @@
+#include "graphs.h"
+
+/**
+ * pbfs_visit - calls an action on every vertex reached by
+ * parallel_breadth_first_traverse, level by level
+ * Vertices of a same level are visited by increasing index, which may
+ * differ from the order breadth_first_traverse visits them in
+ * @csr: the traversed snapshot
+ * @depths: the depth array returned by the traversal
+ * @max_depth: the maximum depth returned by the traversal
+ * @action: a function to perform an action on each vertex along with its depth
+ */
+void pbfs_visit(const csr_graph_t *csr, const size_t *depths,
+		size_t max_depth,
+		void (*action)(const vertex_t *v, size_t depth))
+{
+	size_t *start, *order, i;
+
+	if (!csr || !depths || !action)
+		return;
+	start = calloc(max_depth + 2, sizeof(size_t));
+	order = malloc(sizeof(size_t) * (csr->nb_vertices + 1));
+	if (!start || !order)
+	{
+		free(start), free(order);
+		return;
+	}
+	for (i = 0; i < csr->nb_vertices; i++)
+	{
+		if (depths[i] != PBFS_UNREACHED)
+			start[depths[i] + 1]++;
+	}
+	for (i = 0; i <= max_depth; i++)
+		start[i + 1] += start[i];
+	for (i = 0; i < csr->nb_vertices; i++)
+	{
+		if (depths[i] != PBFS_UNREACHED)
+			order[start[depths[i]]++] = i;
+	}
+	for (i = 0; i < start[max_depth]; i++)
+		action(csr->vertices[order[i]], depths[order[i]]);
+	free(start), free(order);
+}
@@ -0,0 +1,84 @@
+#include "graphs.h"
+
+/**
+* createqueue_t - A function that creates a queue
+* Return: queue created, or NULL on failure
+*/
+queue_t *createqueue_t(void)
+{
+	queue_t *q = malloc(sizeof(queue_t));
+
+	if (q == NULL)
+		return (NULL);
+	q->items = malloc(sizeof(size_t) * QUEUE_MIN_CAPACITY);
+	if (q->items == NULL)
+	{
+		free(q);
+		return (NULL);
+	}
+	q->capacity = QUEUE_MIN_CAPACITY;
+	q->front = 0;
+	q->count = 0;
+	return (q);
+}
+
+/**
+* deletequeue_t - A function that frees a queue
+* @q: queue
+*/
+void deletequeue_t(queue_t *q)
+{
+	if (q == NULL)
+		return;
+	free(q->items);
+	free(q);
+}
+
+/**
+* growqueue_t - A function that doubles the capacity of a full queue
+* The items that wrapped around are moved after the old end of the
+* buffer, so the queue stays contiguous modulo the new capacity
+* @q: queue
+* Return: 1 on success, 0 on failure
+*/
+int growqueue_t(queue_t *q)
+{
+	size_t *items;
+
+	items = realloc(q->items, sizeof(size_t) * q->capacity * 2);
+	if (items == NULL)
+		return (0);
+	memcpy(items + q->capacity, items, sizeof(size_t) * q->front);
+	q->items = items;
+	q->capacity *= 2;
+	return (1);
+}
+
+/**
+* enqueue - A function that appends the item in queue
+* @q: queue
+* @value: value to be stored
+* Return: 1 on success, 0 on failure
+*/
+int enqueue(queue_t *q, size_t value)
+{
+	if (q->count == q->capacity && !growqueue_t(q))
+		return (0);
+	q->items[(q->front + q->count) & (q->capacity - 1)] = value;
+	q->count++;
+	return (1);
+}
+
+/**
+* dequeue - A function that fetches first item in queue
+* @q: queue, which must not be empty
+* Return: first item in queue
+*/
+size_t dequeue(queue_t *q)
+{
+	size_t item = q->items[q->front];
+
+	q->front = (q->front + 1) & (q->capacity - 1);
+	q->count--;
+	return (item);
+}
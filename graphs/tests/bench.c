@@ -0,0 +1,68 @@
+#include "bench.h"
+
+/**
+ * bench_now - reads a monotonic clock
+ * Return: the time in seconds
+ */
+double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * bench_dest - picks the destination of a generated edge
+ * @i: index of the source vertex
+ * @k: number of the edge among those of @i
+ * @nb_vertices: number of vertices of the graph
+ * Return: index of the destination vertex
+ */
+size_t bench_dest(size_t i, size_t k, size_t nb_vertices)
+{
+	unsigned long h = (i + 1) * 2654435761UL + (k + 1) * 40503UL;
+
+	h ^= h >> 15;
+	h *= 2246822519UL;
+	h ^= h >> 13;
+	return (h % nb_vertices);
+}
+
+/**
+ * bench_graph - builds a graph with graph_add_vertex and graph_add_edge
+ * Vertex i is named "v<i>" and has an edge to vertex i + 1, so that
+ * every vertex is reachable from v0, plus @degree edges to vertices
+ * picked by bench_dest. With no extra edge, the graph is a path
+ * @nb_vertices: number of vertices
+ * @degree: number of extra edges of each vertex
+ * Return: pointer to the graph, NULL on failure
+ */
+graph_t *bench_graph(size_t nb_vertices, size_t degree)
+{
+	graph_t *graph = graph_create();
+	char src[BENCH_NAME_SIZE], dest[BENCH_NAME_SIZE];
+	size_t i, k, j;
+	int ok = graph != NULL;
+
+	for (i = 0; ok && i < nb_vertices; i++)
+	{
+		sprintf(src, "v%lu", (unsigned long)i);
+		ok = graph_add_vertex(graph, src) != NULL;
+	}
+	for (i = 0; ok && i < nb_vertices; i++)
+	{
+		sprintf(src, "v%lu", (unsigned long)i);
+		for (k = 0; ok && k <= degree; k++)
+		{
+			j = k ? bench_dest(i, k, nb_vertices) : i + 1;
+			if (j == i || j >= nb_vertices)
+				continue;
+			sprintf(dest, "v%lu", (unsigned long)j);
+			ok = graph_add_edge(graph, src, dest, UNIDIRECTIONAL);
+		}
+	}
+	if (!ok)
+		graph_delete(graph), graph = NULL;
+	return (graph);
+}
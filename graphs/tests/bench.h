@@ -0,0 +1,13 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "../graphs.h"
+#include <time.h>
+
+#define BENCH_NAME_SIZE 24
+
+double bench_now(void);
+size_t bench_dest(size_t i, size_t k, size_t nb_vertices);
+graph_t *bench_graph(size_t nb_vertices, size_t degree);
+
+#endif /* BENCH_H */
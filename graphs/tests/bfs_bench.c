@@ -0,0 +1,80 @@
+#include "bench.h"
+
+/*
+ * Times breadth_first_traverse and csr_breadth_first_traverse on graphs
+ * of 100k to 10M vertices, each with a path through every vertex and
+ * one more edge per vertex, and checks that both visit every vertex
+ * down to the same depth. The former queue_t held 65536 indices and
+ * dropped every vertex enqueued past them, so it failed on each of these
+ * sizes. Build it from graphs/:
+ * gcc -O2 -Wall -Wextra -pedantic -std=gnu89 -I. tests/bfs_bench.c
+ *	tests/bench.c [every source of graphs/] -pthread
+ */
+
+static size_t nb_visited;
+
+/**
+ * count_vertex - action counting the vertices visited
+ * @v: vertex visited
+ * @depth: depth of @v
+ */
+void count_vertex(const vertex_t *v, size_t depth)
+{
+	(void)v, (void)depth;
+	nb_visited++;
+}
+
+/**
+ * bench_size - times both traversals of one graph and prints a row
+ * @nb_vertices: number of vertices
+ * Return: 1 if both visit every vertex down to the same depth, 0 otherwise
+ */
+int bench_size(size_t nb_vertices)
+{
+	graph_t *graph = bench_graph(nb_vertices, 1);
+	csr_graph_t *csr;
+	size_t depth, csr_depth, visited;
+	double t0, t_list, t_csr;
+
+	if (!graph)
+		return (0);
+	nb_visited = 0;
+	t0 = bench_now();
+	depth = breadth_first_traverse(graph, count_vertex);
+	t_list = bench_now() - t0;
+	visited = nb_visited;
+	csr = graph_freeze(graph);
+	graph_delete(graph);
+	if (!csr)
+		return (0);
+	nb_visited = 0;
+	t0 = bench_now();
+	csr_depth = csr_breadth_first_traverse(csr, count_vertex);
+	t_csr = bench_now() - t0;
+	csr_graph_delete(csr);
+	printf("%9lu %9lu %6lu %12.1f %12.1f\n", (unsigned long)nb_vertices,
+	       (unsigned long)visited, (unsigned long)depth, t_list * 1000,
+	       t_csr * 1000);
+	return (visited == nb_vertices && nb_visited == nb_vertices &&
+		depth == csr_depth);
+}
+
+/**
+ * main - runs the benchmark
+ * Return: EXIT_SUCCESS if every traversal visits every vertex
+ */
+int main(void)
+{
+	static size_t const sizes[] = {100000, 1000000, 4000000, 10000000};
+	size_t i;
+
+	printf("%9s %9s %6s %12s %12s\n", "vertices", "visited", "depth",
+	       "bfs (ms)", "csr bfs (ms)");
+	for (i = 0; i < sizeof(sizes) / sizeof(*sizes); i++)
+		if (!bench_size(sizes[i]))
+		{
+			printf("a traversal missed vertices\n");
+			return (EXIT_FAILURE);
+		}
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,101 @@
+#include "bench.h"
+
+/*
+ * Times depth_first_traverse and breadth_first_traverse on graphs built
+ * with graph_add_vertex and graph_add_edge, against their CSR variants
+ * on a graph_freeze snapshot of the same graph, and checks that both
+ * visit as many vertices down to the same depth. Build it from graphs/:
+ * gcc -O2 -Wall -Wextra -pedantic -std=gnu89 -I. tests/csr_traverse_bench.c
+ *	tests/bench.c [every source of graphs/] -pthread
+ */
+
+static size_t nb_visited;
+
+/**
+ * count_vertex - action counting the vertices visited
+ * @v: vertex visited
+ * @depth: depth of @v
+ */
+void count_vertex(const vertex_t *v, size_t depth)
+{
+	(void)v, (void)depth;
+	nb_visited++;
+}
+
+/**
+ * time_traverse - times one traversal
+ * @which: 0 for depth_first_traverse, 1 for csr_depth_first_traverse,
+ *         2 for breadth_first_traverse, 3 for csr_breadth_first_traverse
+ * @graph: graph to traverse
+ * @csr: snapshot of @graph
+ * @result: where to store the depth returned and the vertices visited
+ * Return: the time taken in milliseconds
+ */
+double time_traverse(int which, const graph_t *graph, const csr_graph_t *csr,
+		     size_t *result)
+{
+	double t0 = bench_now();
+
+	nb_visited = 0;
+	if (which == 0)
+		result[0] = depth_first_traverse(graph, count_vertex);
+	else if (which == 1)
+		result[0] = csr_depth_first_traverse(csr, count_vertex);
+	else if (which == 2)
+		result[0] = breadth_first_traverse(graph, count_vertex);
+	else
+		result[0] = csr_breadth_first_traverse(csr, count_vertex);
+	result[1] = nb_visited;
+	return ((bench_now() - t0) * 1000);
+}
+
+/**
+ * bench_size - times every traversal on one graph and prints a row
+ * @nb_vertices: number of vertices
+ * Return: 1 if both forms agree, 0 otherwise
+ */
+int bench_size(size_t nb_vertices)
+{
+	graph_t *graph = bench_graph(nb_vertices, 3);
+	csr_graph_t *csr;
+	size_t r[4][2];
+	double t[5], t0;
+	int i;
+
+	if (!graph)
+		return (0);
+	t0 = bench_now();
+	csr = graph_freeze(graph);
+	t[0] = (bench_now() - t0) * 1000;
+	if (!csr)
+		return (graph_delete(graph), 0);
+	for (i = 0; i < 4; i++)
+		t[i + 1] = time_traverse(i, graph, csr, r[i]);
+	printf("%9lu %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+	       (unsigned long)nb_vertices, t[0], t[1], t[2], t[3], t[4]);
+	csr_graph_delete(csr);
+	graph_delete(graph);
+	return (r[0][0] == r[1][0] && r[0][1] == r[1][1] &&
+		r[2][0] == r[3][0] && r[2][1] == r[3][1]);
+}
+
+/**
+ * main - runs the benchmark
+ * Return: EXIT_SUCCESS if both forms agree on every graph
+ */
+int main(void)
+{
+	static size_t const sizes[] = {100000, 1000000, 4000000};
+	size_t i;
+
+	printf("%9s %10s %10s %10s %10s %10s\n", "vertices", "freeze",
+	       "dfs", "csr dfs", "bfs", "csr bfs");
+	for (i = 0; i < sizeof(sizes) / sizeof(*sizes); i++)
+		if (!bench_size(sizes[i]))
+		{
+			printf("the traversals disagree\n");
+			return (EXIT_FAILURE);
+		}
+	printf("times in ms\n");
+	return (EXIT_SUCCESS);
+}
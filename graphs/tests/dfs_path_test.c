@@ -0,0 +1,119 @@
+#include "bench.h"
+
+/*
+ * Checks depth_first_traverse against the recursive traversal it
+ * replaced, on a graph of 2000 vertices (the former one could not go past
+ * 2048), then on a path graph of 5M vertices that the recursion
+ * overflowed the call stack on: every vertex must be visited in order at
+ * its own depth, and the maximum depth must be 4999999. Build it from
+ * graphs/:
+ * gcc -O2 -Wall -Wextra -pedantic -std=gnu89 -I. tests/dfs_path_test.c
+ *	tests/bench.c [every source of graphs/] -pthread
+ */
+
+#define PATH_SIZE 5000000
+
+static size_t *visits, nb_visits;
+
+/**
+ * record_vertex - action recording the index and depth of each vertex
+ * @v: vertex visited
+ * @depth: depth of @v
+ */
+void record_vertex(const vertex_t *v, size_t depth)
+{
+	visits[nb_visits++] = v->index;
+	visits[nb_visits++] = depth;
+}
+
+/**
+ * legacy_visit - traverseVerticesRecursively, the recursion of the
+ * former depth_first_traverse
+ * @vertex: the starting vertex to traverse from
+ * @visited: an array indicating whether vertices have been visited
+ * @depth: the current depth level in traversal
+ * @action: a function to perform an action on each vertex
+ * Return: the maximum depth reached during traversal
+ */
+size_t legacy_visit(vertex_t *vertex, char *visited, size_t depth,
+		    void (*action)(const vertex_t *v, size_t depth))
+{
+	size_t new_depth, max_depth = depth, flag = 0;
+	edge_t *edge;
+
+	for (edge = vertex->edges; edge; edge = edge->next)
+		if (!visited[edge->dest->index])
+		{
+			action(edge->dest, depth);
+			visited[edge->dest->index] = 1;
+			new_depth = legacy_visit(edge->dest, visited, depth + 1,
+						 action);
+			if (new_depth > max_depth)
+				max_depth = new_depth;
+			flag = 1;
+		}
+	return (flag ? max_depth : max_depth - 1);
+}
+
+/**
+ * check_small - compares depth_first_traverse with the former traversal
+ * on a graph small enough for it
+ * @nb_vertices: number of vertices, at most 2048
+ * Return: 1 if both make the same calls and return the same depth
+ */
+int check_small(size_t nb_vertices)
+{
+	graph_t *graph = bench_graph(nb_vertices, 3);
+	char *visited = calloc(nb_vertices, 1);
+	size_t *expected = malloc(sizeof(*expected) * 4 * nb_vertices);
+	size_t depth = 0, legacy_depth = 0, nb_expected;
+	int ok = graph && visited && expected;
+
+	visits = expected, nb_visits = 0;
+	if (ok)
+	{
+		record_vertex(graph->vertices, 0);
+		visited[graph->vertices->index] = 1;
+		legacy_depth = legacy_visit(graph->vertices, visited, 1,
+					    record_vertex);
+		nb_expected = nb_visits;
+		visits = expected + nb_expected, nb_visits = 0;
+		depth = depth_first_traverse(graph, record_vertex);
+		ok = depth == legacy_depth && nb_visits == nb_expected &&
+			!memcmp(expected, visits, nb_visits * sizeof(*visits));
+	}
+	printf("%lu vertices: depth %lu, former depth %lu, %s\n",
+	       (unsigned long)nb_vertices, (unsigned long)depth,
+	       (unsigned long)legacy_depth, ok ? "same calls" : "differ");
+	graph_delete(graph), free(visited), free(expected);
+	return (ok);
+}
+
+/**
+ * main - runs the checks
+ * Return: EXIT_SUCCESS if every check passes
+ */
+int main(void)
+{
+	graph_t *graph;
+	size_t depth, i;
+	double t0, t;
+	int ok = check_small(2000);
+
+	graph = bench_graph(PATH_SIZE, 0);
+	visits = malloc(sizeof(*visits) * 2 * PATH_SIZE);
+	if (!graph || !visits)
+		return (graph_delete(graph), free(visits), EXIT_FAILURE);
+	nb_visits = 0;
+	t0 = bench_now();
+	depth = depth_first_traverse(graph, record_vertex);
+	t = bench_now() - t0;
+	ok = ok && depth == PATH_SIZE - 1 && nb_visits == 2 * PATH_SIZE;
+	for (i = 0; ok && i < PATH_SIZE; i++)
+		ok = visits[2 * i] == i && visits[2 * i + 1] == i;
+	printf("%d-vertex path: depth %lu, %lu visited in %.1f ms, %s\n",
+	       PATH_SIZE, (unsigned long)depth, (unsigned long)nb_visits / 2,
+	       t * 1000, ok ? "OK" : "FAILED");
+	graph_delete(graph), free(visits);
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
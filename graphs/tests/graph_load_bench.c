@@ -0,0 +1,158 @@
+#include "bench.h"
+
+/*
+ * Times loading graphs of 10k to 2M vertices, each with about 3 edges
+ * per vertex, through graph_add_vertex and graph_add_edge, against the
+ * list walks with strcmp they did before the hash index. The walks are
+ * O(V^2), so they only run up to the size given as first argument
+ * (20000 by default). Build it from graphs/:
+ * gcc -O2 -Wall -Wextra -pedantic -std=gnu89 -I. tests/graph_load_bench.c
+ *	tests/bench.c [every source of graphs/] -pthread
+ */
+
+vertex_t *create_vertex(const char *str);
+edge_t *graph_add_single_edge(vertex_t *src_vertex, vertex_t *dest_vertex);
+
+/**
+ * legacy_add_vertex - the former graph_add_vertex, which walked the
+ * whole vertex list to reject a duplicate and find the tail
+ * @graph: pointer to graph type
+ * @str: string value for new vertex
+ * Return: pointer to vertex or null
+ */
+vertex_t *legacy_add_vertex(graph_t *graph, const char *str)
+{
+	vertex_t *vertex_ptr, *prev_vertex_ptr = NULL, *vertex;
+
+	for (vertex_ptr = graph->vertices; vertex_ptr;
+	     vertex_ptr = vertex_ptr->next)
+	{
+		if (strcmp(vertex_ptr->content, str) == 0)
+			return (NULL);
+		prev_vertex_ptr = vertex_ptr;
+	}
+	vertex = create_vertex(str);
+	if (vertex == NULL)
+		return (NULL);
+	if (prev_vertex_ptr)
+		prev_vertex_ptr->next = vertex;
+	else
+		graph->vertices = vertex;
+	vertex->index = graph->nb_vertices++;
+	return (vertex);
+}
+
+/**
+ * legacy_add_edge - the former graph_add_edge, which walked the whole
+ * vertex list to resolve both names
+ * @graph: the graph to which the edge should be added
+ * @src: the content of the source vertex
+ * @dest: the content of the destination vertex
+ * Return: 1 on success, 0 on failure
+ */
+int legacy_add_edge(graph_t *graph, const char *src, const char *dest)
+{
+	vertex_t *temp_vertex, *src_vertex = NULL, *dest_vertex = NULL;
+
+	for (temp_vertex = graph->vertices; temp_vertex;
+	     temp_vertex = temp_vertex->next)
+	{
+		if (strcmp(temp_vertex->content, src) == 0)
+			src_vertex = temp_vertex;
+		else if (strcmp(temp_vertex->content, dest) == 0)
+			dest_vertex = temp_vertex;
+	}
+	if (!src_vertex || !dest_vertex)
+		return (0);
+	return (graph_add_single_edge(src_vertex, dest_vertex) != NULL);
+}
+
+/**
+ * legacy_graph - builds the same graph as bench_graph with the former
+ * lookups
+ * @nb_vertices: number of vertices
+ * @degree: number of extra edges of each vertex
+ * Return: pointer to the graph, NULL on failure
+ */
+graph_t *legacy_graph(size_t nb_vertices, size_t degree)
+{
+	graph_t *graph = graph_create();
+	char src[BENCH_NAME_SIZE], dest[BENCH_NAME_SIZE];
+	size_t i, k, j;
+	int ok = graph != NULL;
+
+	for (i = 0; ok && i < nb_vertices; i++)
+	{
+		sprintf(src, "v%lu", (unsigned long)i);
+		ok = legacy_add_vertex(graph, src) != NULL;
+	}
+	for (i = 0; ok && i < nb_vertices; i++)
+	{
+		sprintf(src, "v%lu", (unsigned long)i);
+		for (k = 0; ok && k <= degree; k++)
+		{
+			j = k ? bench_dest(i, k, nb_vertices) : i + 1;
+			if (j == i || j >= nb_vertices)
+				continue;
+			sprintf(dest, "v%lu", (unsigned long)j);
+			ok = legacy_add_edge(graph, src, dest);
+		}
+	}
+	if (!ok)
+		graph_delete(graph), graph = NULL;
+	return (graph);
+}
+
+/**
+ * bench_size - times both loads of one graph and prints a row
+ * @nb_vertices: number of vertices
+ * @legacy_max: largest number of vertices the former lookups run on
+ * Return: 1 on success, 0 on failure
+ */
+int bench_size(size_t nb_vertices, size_t legacy_max)
+{
+	graph_t *graph;
+	double t0, t_index, t_legacy = -1;
+
+	t0 = bench_now();
+	graph = bench_graph(nb_vertices, 2);
+	t_index = bench_now() - t0;
+	if (!graph)
+		return (0);
+	graph_delete(graph);
+	if (nb_vertices <= legacy_max)
+	{
+		t0 = bench_now();
+		graph = legacy_graph(nb_vertices, 2);
+		t_legacy = bench_now() - t0;
+		if (!graph)
+			return (0);
+		graph_delete(graph);
+	}
+	printf("%9lu %12.1f", (unsigned long)nb_vertices, t_index * 1000);
+	if (t_legacy < 0)
+		printf(" %12s %9s\n", "skipped", "-");
+	else
+		printf(" %12.1f %8.1fx\n", t_legacy * 1000, t_legacy / t_index);
+	return (1);
+}
+
+/**
+ * main - runs the benchmark
+ * @ac: number of arguments
+ * @av: arguments, the optional largest size the former lookups run on
+ * Return: EXIT_SUCCESS, or EXIT_FAILURE if a graph cannot be built
+ */
+int main(int ac, char **av)
+{
+	static size_t const sizes[] = {10000, 20000, 100000, 1000000, 2000000};
+	size_t legacy_max = ac > 1 ? strtoul(av[1], NULL, 10) : 20000;
+	size_t i;
+
+	printf("%9s %12s %12s %9s\n", "vertices", "index (ms)", "walk (ms)",
+	       "speedup");
+	for (i = 0; i < sizeof(sizes) / sizeof(*sizes); i++)
+		if (!bench_size(sizes[i], legacy_max))
+			return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
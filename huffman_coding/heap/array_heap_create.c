@@ -0,0 +1,35 @@
+#include "heap.h"
+
+/**
+ * array_heap_create - program that creates a new array-backed heap
+ * @data_cmp: a pointer to the comparison function for the elements
+ * Return: a pointer to the created array_heap_t structure,
+ *         or NULL if it fails
+ */
+
+array_heap_t *array_heap_create(int (*data_cmp)(void *, void *))
+{
+	array_heap_t *heap = NULL;
+
+	if (data_cmp == NULL)
+		return (NULL);
+
+	heap = malloc(sizeof(array_heap_t));
+
+	if (heap == NULL)
+		return (NULL);
+
+	heap->items = malloc(sizeof(void *) * ARRAY_HEAP_MIN_CAPACITY);
+
+	if (heap->items == NULL)
+	{
+		free(heap);
+		return (NULL);
+	}
+
+	heap->size = 0;
+	heap->capacity = ARRAY_HEAP_MIN_CAPACITY;
+	heap->data_cmp = data_cmp;
+
+	return (heap);
+}
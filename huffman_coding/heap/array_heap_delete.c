@@ -0,0 +1,26 @@
+#include "heap.h"
+
+/**
+ * array_heap_delete - program that deallocates an array heap
+ * @heap: a pointer to the heap to be deallocated
+ * @free_data: a pointer to the function that frees the elements
+ *             (or NULL if not needed)
+ * Return: nothing (void)
+ */
+
+void array_heap_delete(array_heap_t *heap, void (*free_data)(void *))
+{
+	size_t i;
+
+	if (heap == NULL)
+		return;
+
+	if (free_data != NULL)
+	{
+		for (i = 0; i < heap->size; i++)
+			free_data(heap->items[i]);
+	}
+
+	free(heap->items);
+	free(heap);
+}
@@ -0,0 +1,64 @@
+#include "heap.h"
+
+/**
+ * array_heap_sift_down - program that moves the element at a given index
+ * down the heap until the min-heap property is restored
+ * Ties are broken the same way as restore_heapify
+ * @heap: a pointer to the heap
+ * @i: the index of the element to move
+ * Return: nothing (void)
+ */
+
+void array_heap_sift_down(array_heap_t *heap, size_t i)
+{
+	size_t left, right, lg;
+	void *swap;
+
+	for (;;)
+	{
+		left = 2 * i + 1;
+		right = left + 1;
+		lg = i;
+
+		if (left < heap->size &&
+		    heap->data_cmp(heap->items[i], heap->items[left]) >= 0)
+			lg = left;
+
+		if (right < heap->size &&
+		    heap->data_cmp(heap->items[i], heap->items[right]) >= 0 &&
+		    (lg == i ||
+		     heap->data_cmp(heap->items[lg], heap->items[right]) > 0))
+			lg = right;
+
+		if (lg == i)
+			break;
+
+		swap = heap->items[i];
+		heap->items[i] = heap->items[lg];
+		heap->items[lg] = swap;
+		i = lg;
+	}
+}
+
+/**
+ * array_heap_extract - program that extracts the root element from
+ * an array heap and restores the min-heap property
+ * @heap: the heap from which to extract the root
+ * Return: the extracted element, or NULL if the heap is empty
+ */
+
+void *array_heap_extract(array_heap_t *heap)
+{
+	void *data;
+
+	if (!heap || heap->size == 0)
+		return (NULL);
+
+	data = heap->items[0];
+	heap->items[0] = heap->items[--heap->size];
+
+	if (heap->size > 1)
+		array_heap_sift_down(heap, 0);
+
+	return (data);
+}
@@ -0,0 +1,75 @@
+#include "heap.h"
+
+/**
+ * array_heap_grow - program that doubles the capacity of an array heap
+ * @heap: a pointer to the heap to grow
+ * Return: 1 on success, 0 if the reallocation fails
+ */
+
+int array_heap_grow(array_heap_t *heap)
+{
+	void **items;
+	size_t capacity;
+
+	capacity = heap->capacity * 2;
+	items = realloc(heap->items, sizeof(void *) * capacity);
+
+	if (!items)
+		return (0);
+
+	heap->items = items;
+	heap->capacity = capacity;
+
+	return (1);
+}
+
+/**
+ * array_heap_sift_up - program that moves the element at a given index
+ * up the heap as long as it is smaller than its parent
+ * @heap: a pointer to the heap
+ * @i: the index of the element to move
+ * Return: nothing (void)
+ */
+
+void array_heap_sift_up(array_heap_t *heap, size_t i)
+{
+	void *swap;
+	size_t parent;
+
+	while (i > 0)
+	{
+		parent = (i - 1) / 2;
+
+		if (heap->data_cmp(heap->items[i], heap->items[parent]) >= 0)
+			break;
+
+		swap = heap->items[i];
+		heap->items[i] = heap->items[parent];
+		heap->items[parent] = swap;
+		i = parent;
+	}
+}
+
+/**
+ * array_heap_insert - program that inserts an element into an array heap
+ * and restores the min-heap property
+ * The elements end up in the same order as with heap_insert
+ * @heap: a pointer to the heap structure
+ * @data: the element to insert
+ * Return: @data on success, or NULL on failure
+ */
+
+void *array_heap_insert(array_heap_t *heap, void *data)
+{
+	if (!heap || !data)
+		return (NULL);
+
+	if (heap->size == heap->capacity && !array_heap_grow(heap))
+		return (NULL);
+
+	heap->items[heap->size] = data;
+	array_heap_sift_up(heap, heap->size);
+	heap->size++;
+
+	return (data);
+}
@@ -52,6 +52,27 @@ typedef struct binary_tree_node_queue_s
 } bt_node_queue_t;
 
 
+/**
+ * struct array_heap_s - Heap data structure stored in a contiguous array
+ * The children of the element at index i are stored at indexes 2i + 1
+ * and 2i + 2, so no node has to be allocated on insertion
+ * @size: the number of elements in the heap
+ * @capacity: the number of slots allocated in @items
+ * @data_cmp: the function to compare two elements
+ * @items: the array of elements, @items[0] being the root
+ */
+
+typedef struct array_heap_s
+{
+	size_t size;
+	size_t capacity;
+	int (*data_cmp)(void *, void *);
+	void **items;
+} array_heap_t;
+
+#define ARRAY_HEAP_MIN_CAPACITY 16
+
+
 /* task 0 */
 heap_t *heap_create(int (*data_cmp)(void *, void *));
 
@@ -84,4 +105,13 @@ void *heap_extract(heap_t *heap);
 void recursive_node_free(binary_tree_node_t *node, void (*free_data)(void *));
 void heap_delete(heap_t *heap, void (*free_data)(void *));
 
+/* array-backed heap */
+array_heap_t *array_heap_create(int (*data_cmp)(void *, void *));
+int array_heap_grow(array_heap_t *heap);
+void array_heap_sift_up(array_heap_t *heap, size_t i);
+void *array_heap_insert(array_heap_t *heap, void *data);
+void array_heap_sift_down(array_heap_t *heap, size_t i);
+void *array_heap_extract(array_heap_t *heap);
+void array_heap_delete(array_heap_t *heap, void (*free_data)(void *));
+
 #endif /* HEAP_H */
@@ -3,8 +3,26 @@
 
 #include <stdlib.h>
 #include <stddef.h>
+#include <stdio.h>
 #include "heap/heap.h"
 
+#define HUFFMAN_NB_SYMBOLS 256
+#define HUFFMAN_WORD_BITS 64
+#define HUFFMAN_BUFFER_SIZE 65536
+#define HUFFMAN_MAGIC "HUF1"
+#define HUFFMAN_HEADER_SIZE (4 + 8 + HUFFMAN_NB_SYMBOLS)
+#define HUFFMAN_MAX_BITS 57
+#define HUFFMAN_PRIMARY_BITS 11
+#define HUFFMAN_SUB_BITS 8
+#define HUFFMAN_ENTRY_SYMBOLS 4
+#define HUFFMAN_FILE_BITS (HUFFMAN_PRIMARY_BITS + HUFFMAN_SUB_BITS)
+#define HUFFMAN_LENGTH_BITS 6
+#define HUFFMAN_PACK(code, length) \
+	(((unsigned long)(code) << HUFFMAN_LENGTH_BITS) | (length))
+#define HUFFMAN_CODE(entry) ((entry) >> HUFFMAN_LENGTH_BITS)
+#define HUFFMAN_LENGTH(entry) \
+	((size_t)((entry) & ((1UL << HUFFMAN_LENGTH_BITS) - 1)))
+
 /**
  * struct symbol_s - Structure that stores a char
  * and its associated frequency
@@ -20,6 +38,139 @@ typedef struct symbol_s
 
 
 
+/**
+ * struct huffman_flat_s - Huffman tree whose nodes live in one array
+ * The leaves come first, sorted by frequency, followed by the internal
+ * nodes in the order they are merged, so the root is the last node
+ * @nodes: the nodes of the tree
+ * @symbols: the symbol of each node, pointed to by its data
+ * @nb_nodes: the number of nodes, 2 * size - 1 for size symbols
+ */
+
+typedef struct huffman_flat_s
+{
+	binary_tree_node_t *nodes;
+	symbol_t *symbols;
+	size_t nb_nodes;
+} huffman_flat_t;
+
+#define HUFFMAN_RADIX_BITS 8
+
+/**
+ * struct huffman_table_s - Canonical Huffman code of every byte value
+ * Codes are assigned by increasing length, then by increasing symbol,
+ * so the lengths alone are enough to rebuild them
+ * @lengths: the code length of each symbol, 0 for absent symbols
+ * @codes: the code of each symbol packed with its length, see
+ *         HUFFMAN_PACK; the first bit of a code is its most significant
+ * @max_length: the length of the longest code
+ */
+
+typedef struct huffman_table_s
+{
+	unsigned char lengths[HUFFMAN_NB_SYMBOLS];
+	unsigned long codes[HUFFMAN_NB_SYMBOLS];
+	size_t max_length;
+} huffman_table_t;
+
+
+/**
+ * struct huffman_encoder_s - Streaming encoder of bytes with a canonical
+ * Huffman code
+ * Codes are appended to the most significant free bits of @acc, and
+ * @acc is stored big-endian in @buffer once its 64 bits are full, so the
+ * output is the concatenation of the codes, first bit first
+ * @table: the code of each byte
+ * @acc: the bits not stored yet, aligned on the most significant bit
+ * @nb_bits: the number of bits in @acc
+ * @buffer: the bytes not written to @file yet
+ * @buffered: the number of bytes in @buffer
+ * @file: where the encoded bytes are written
+ * @total_bits: the number of bits encoded so far
+ */
+
+typedef struct huffman_encoder_s
+{
+	const huffman_table_t *table;
+	unsigned long acc;
+	size_t nb_bits;
+	unsigned char buffer[HUFFMAN_BUFFER_SIZE];
+	size_t buffered;
+	FILE *file;
+	size_t total_bits;
+} huffman_encoder_t;
+
+/**
+ * struct huffman_entry_s - Entry of a decoding table, indexed by the
+ * next bits of the input
+ * @symbols: the symbols decoded from these bits, in order
+ * @nb_symbols: the number of symbols, 0 for a link to a subtable or for
+ *              bits that start no code
+ * @length: the number of bits consumed by the symbols or by the link
+ * @first_length: the number of bits consumed by the first symbol alone
+ * @sub_bits: the number of bits indexing the linked subtable, 0 if none
+ * @link: the index of the first entry of the linked subtable
+ */
+
+typedef struct huffman_entry_s
+{
+	unsigned char symbols[HUFFMAN_ENTRY_SYMBOLS];
+	unsigned char nb_symbols;
+	unsigned char length;
+	unsigned char first_length;
+	unsigned char sub_bits;
+	unsigned int link;
+} huffman_entry_t;
+
+/**
+ * struct huffman_decoder_s - Decoding tables of a canonical code
+ * The first 1 << HUFFMAN_PRIMARY_BITS entries are the primary table;
+ * codes longer than that continue in subtables of at most
+ * HUFFMAN_SUB_BITS bits, which may link to further subtables
+ * @entries: all the tables, the primary one first
+ * @nb_entries: the number of entries in use
+ * @capacity: the number of entries allocated
+ * @table: the code the tables are built from
+ * @order: the symbols of the code sorted by length, then by value, which
+ *         is also the order of their codes
+ * @nb_symbols: the number of symbols in @order
+ */
+
+typedef struct huffman_decoder_s
+{
+	huffman_entry_t *entries;
+	size_t nb_entries;
+	size_t capacity;
+	const huffman_table_t *table;
+	unsigned char order[HUFFMAN_NB_SYMBOLS];
+	size_t nb_symbols;
+} huffman_decoder_t;
+
+/**
+ * struct huffman_reader_s - Bit reader over a file, first bit first
+ * @file: the file to read
+ * @buffer: the bytes read from @file and not consumed yet
+ * @pos: the index of the next byte to consume in @buffer
+ * @end: the number of bytes in @buffer
+ * @acc: the next bits, aligned on the most significant bit
+ * @nb_bits: the number of bits in @acc
+ * @padding: the number of zero bits appended to @acc past the end of
+ *           @file; @nb_bits drops below it once a code is read past the
+ *           end of @file
+ */
+
+typedef struct huffman_reader_s
+{
+	FILE *file;
+	unsigned char buffer[HUFFMAN_BUFFER_SIZE];
+	size_t pos;
+	size_t end;
+	unsigned long acc;
+	size_t nb_bits;
+	size_t padding;
+} huffman_reader_t;
+
+
 /* task 5 */
 symbol_t *symbol_create(char data, size_t freq);
 
@@ -27,10 +178,15 @@ symbol_t *symbol_create(char data, size_t freq);
 /* task 6 */
 int compare_frequencies(void *p1, void *p2);
 heap_t *huffman_priority_queue(char *data, size_t *freq, size_t size);
+array_heap_t *huffman_array_priority_queue(char *data, size_t *freq,
+					   size_t size);
 
 
 /* task 7 */
+binary_tree_node_t *huffman_combine(binary_tree_node_t *node1,
+				    binary_tree_node_t *node2);
 int huffman_extract_and_insert(heap_t *priority_queue);
+int huffman_array_extract_and_insert(array_heap_t *priority_queue);
 
 
 /* task 8 */
@@ -44,4 +200,69 @@ size_t calculate_tree_depth(binary_tree_node_t *root, size_t depth);
 void print_huffman_codes_recursive(binary_tree_node_t *root, char *code,
 				   size_t depth);
 
+/* linear-time construction */
+int huffman_radix_sort(size_t *freq, size_t size, size_t *order);
+huffman_flat_t *huffman_flat_create(size_t size);
+void huffman_flat_delete(huffman_flat_t *tree);
+size_t huffman_two_queue_pick(huffman_flat_t *tree, size_t *leaf,
+			      size_t nb_leaves, size_t *node, size_t end);
+huffman_flat_t *huffman_tree_linear(char *data, size_t *freq, size_t size);
+
+/* canonical code table */
+size_t huffman_code_lengths(binary_tree_node_t *root, size_t depth,
+			    unsigned char *lengths);
+int huffman_canonical(huffman_table_t *table);
+int huffman_table_from_tree(binary_tree_node_t *root, huffman_table_t *table);
+int huffman_table_build(char *data, size_t *freq, size_t size,
+			huffman_table_t *table);
+size_t huffman_table_serialize(const huffman_table_t *table,
+			       unsigned char *buf);
+int huffman_table_deserialize(const unsigned char *buf,
+			      huffman_table_t *table);
+
+/* streaming encoder */
+void huffman_encoder_init(huffman_encoder_t *enc,
+			  const huffman_table_t *table, FILE *file);
+int huffman_encoder_put_word(huffman_encoder_t *enc, unsigned long word);
+int huffman_encode(huffman_encoder_t *enc, const unsigned char *data,
+		   size_t size);
+int huffman_encoder_finish(huffman_encoder_t *enc);
+int huffman_count_file(FILE *file, size_t *counts, size_t *total);
+int huffman_write_header(FILE *file, const huffman_table_t *table,
+			 size_t total);
+int huffman_encode_stream(FILE *in, FILE *out, const huffman_table_t *table);
+int huffman_encode_file(const char *in_path, const char *out_path);
+
+/* table-driven decoder */
+size_t huffman_decoder_grow(huffman_decoder_t *dec, size_t nb_entries);
+void huffman_decoder_put(huffman_decoder_t *dec, size_t base, size_t i,
+			 size_t done, size_t width);
+int huffman_decoder_fill(huffman_decoder_t *dec, size_t base, size_t done,
+			 size_t width, size_t lo, size_t hi);
+void huffman_decoder_multi(huffman_decoder_t *dec);
+huffman_decoder_t *huffman_decoder_create(const huffman_table_t *table);
+void huffman_decoder_delete(huffman_decoder_t *dec);
+void huffman_reader_init(huffman_reader_t *reader, FILE *file);
+int huffman_reader_refill(huffman_reader_t *reader);
+size_t huffman_decode(const huffman_decoder_t *dec, huffman_reader_t *reader,
+		      unsigned char *out, size_t count);
+int huffman_read_header(FILE *file, huffman_table_t *table, size_t *total);
+int huffman_decode_stream(FILE *in, FILE *out, const huffman_table_t *table,
+			  size_t total);
+int huffman_decode_file(const char *in_path, const char *out_path);
+
+/* length-limited codes */
+size_t huffman_package_merge_level(size_t *weights, size_t size,
+				   size_t *prev, size_t nb_prev,
+				   size_t *next, unsigned char *leaf);
+int huffman_package_merge(size_t *weights, size_t size, size_t max_length,
+			  unsigned char *lengths);
+int huffman_lengths_limited(char *data, size_t *freq, size_t size,
+			    size_t max_length, unsigned char *lengths);
+int huffman_table_build_limited(char *data, size_t *freq, size_t size,
+				size_t max_length, huffman_table_t *table);
+size_t huffman_tree_cost(binary_tree_node_t *root, size_t depth);
+int huffman_limit_loss(char *data, size_t *freq, size_t size,
+		       size_t max_length, size_t *loss);
+
 #endif /* HUFFMAN_H */
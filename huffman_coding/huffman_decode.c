@@ -0,0 +1,132 @@
+#include "huffman.h"
+
+/**
+ * huffman_decoder_delete - program that frees a decoder
+ * @dec: a pointer to the decoder, may be NULL
+ */
+
+void huffman_decoder_delete(huffman_decoder_t *dec)
+{
+	if (!dec)
+		return;
+	free(dec->entries);
+	free(dec);
+}
+
+/**
+ * huffman_reader_init - program that prepares a bit reader
+ * @reader: a pointer to the reader
+ * @file: the file to read from its current position
+ */
+
+void huffman_reader_init(huffman_reader_t *reader, FILE *file)
+{
+	reader->file = file;
+	reader->pos = 0;
+	reader->end = 0;
+	reader->acc = 0;
+	reader->nb_bits = 0;
+	reader->padding = 0;
+}
+
+/**
+ * huffman_reader_refill - program that tops up the bits of a reader to
+ * at least HUFFMAN_MAX_BITS
+ * Away from the end of the file, 8 bytes are loaded at once; the bits
+ * that do not fit are loaded again by the next refill. Past the end,
+ * zero bytes are appended as padding
+ * @reader: a pointer to the reader, holding less than HUFFMAN_MAX_BITS
+ * Return: 1 on success, 0 if only padding is left
+ */
+
+int huffman_reader_refill(huffman_reader_t *reader)
+{
+	unsigned char *in;
+	unsigned long word = 0;
+	size_t i;
+
+	if (reader->end - reader->pos >= 8)
+	{
+		in = reader->buffer + reader->pos;
+		for (i = 0; i < 8; i++)
+			word = word << 8 | in[i];
+		reader->acc |= word >> reader->nb_bits;
+		reader->pos += (HUFFMAN_WORD_BITS - reader->nb_bits) >> 3;
+		reader->nb_bits += (HUFFMAN_WORD_BITS - reader->nb_bits) & ~7UL;
+		return (1);
+	}
+	if (!feof(reader->file) && !ferror(reader->file))
+	{
+		reader->end -= reader->pos;
+		memmove(reader->buffer, reader->buffer + reader->pos,
+			reader->end);
+		reader->pos = 0;
+		reader->end += fread(reader->buffer + reader->end, 1,
+				     HUFFMAN_BUFFER_SIZE - reader->end,
+				     reader->file);
+	}
+	if (reader->end - reader->pos >= 8)
+		return (huffman_reader_refill(reader));
+	in = reader->buffer;
+	for (; reader->nb_bits + 8 <= HUFFMAN_WORD_BITS; reader->nb_bits += 8)
+		if (reader->pos < reader->end)
+			reader->acc |= (unsigned long)in[reader->pos++] <<
+				(HUFFMAN_WORD_BITS - 8 - reader->nb_bits);
+		else if (reader->padding == reader->nb_bits)
+			return (0);
+		else
+			reader->padding += 8;
+	return (1);
+}
+
+/**
+ * huffman_decode - program that decodes symbols from a bit reader
+ * Each step looks up the next HUFFMAN_PRIMARY_BITS bits, follows the
+ * links of long codes to their subtables, and emits every symbol of the
+ * entry it ends on, or only the first one when fewer are wanted or when
+ * the others would read past the end of the file. A code ending in the
+ * padding means the input is truncated: its symbol is dropped, and the
+ * reader stays failed as @reader->nb_bits is then below @reader->padding
+ * @dec: the decoding tables
+ * @reader: a pointer to the reader
+ * @out: where to write the symbols
+ * @count: the number of symbols to decode
+ * Return: the number of symbols decoded, less than @count if the input
+ * is truncated or holds bits that start no code
+ */
+
+size_t huffman_decode(const huffman_decoder_t *dec, huffman_reader_t *reader,
+		      unsigned char *out, size_t count)
+{
+	const huffman_entry_t *entries = dec->entries, *entry;
+	size_t n = 0, k, nb_symbols, length;
+
+	while (n < count && reader->nb_bits >= reader->padding)
+	{
+		if (reader->nb_bits < HUFFMAN_MAX_BITS &&
+		    !huffman_reader_refill(reader))
+			break;
+		entry = entries + (reader->acc >>
+				   (HUFFMAN_WORD_BITS - HUFFMAN_PRIMARY_BITS));
+		while (!entry->nb_symbols && entry->sub_bits)
+		{
+			reader->acc <<= entry->length;
+			reader->nb_bits -= entry->length;
+			entry = entries + entry->link + (reader->acc >>
+				(HUFFMAN_WORD_BITS - entry->sub_bits));
+		}
+		if (!entry->nb_symbols)
+			break;
+		nb_symbols = entry->nb_symbols, length = entry->length;
+		if (nb_symbols > count - n ||
+		    reader->nb_bits < reader->padding + length)
+			nb_symbols = 1, length = entry->first_length;
+		reader->acc <<= length;
+		reader->nb_bits -= length;
+		if (reader->nb_bits < reader->padding)
+			break;
+		for (k = 0; k < nb_symbols; k++)
+			out[n++] = entry->symbols[k];
+	}
+	return (n);
+}
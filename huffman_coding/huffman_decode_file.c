@@ -0,0 +1,88 @@
+#include "huffman.h"
+
+/**
+ * huffman_read_header - program that reads the header written by
+ * huffman_write_header
+ * @file: the file to read
+ * @table: where to rebuild the code of the payload
+ * @total: where to store the number of bytes the payload decodes to
+ * Return: 1 on success, 0 on read error or if the header is invalid
+ */
+
+int huffman_read_header(FILE *file, huffman_table_t *table, size_t *total)
+{
+	unsigned char header[HUFFMAN_HEADER_SIZE];
+	size_t i;
+
+	if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+	    memcmp(header, HUFFMAN_MAGIC, 4))
+		return (0);
+	*total = 0;
+	for (i = 0; i < 8; i++)
+		*total = *total << 8 | header[4 + i];
+	if (!huffman_table_deserialize(header + 12, table))
+		return (0);
+	return (*total == 0 || table->max_length > 0);
+}
+
+/**
+ * huffman_decode_stream - program that decodes a payload chunk by chunk
+ * @in: the file holding the payload, at its first byte
+ * @out: where to write the decoded bytes
+ * @table: the code of the payload
+ * @total: the number of bytes to decode
+ * Return: 1 on success, 0 on error
+ */
+
+int huffman_decode_stream(FILE *in, FILE *out, const huffman_table_t *table,
+			  size_t total)
+{
+	unsigned char chunk[HUFFMAN_BUFFER_SIZE];
+	huffman_reader_t *reader = malloc(sizeof(*reader));
+	huffman_decoder_t *dec = huffman_decoder_create(table);
+	size_t count, n;
+	int ok = reader && dec;
+
+	if (ok)
+		huffman_reader_init(reader, in);
+	while (ok && total)
+	{
+		count = total < sizeof(chunk) ? total : sizeof(chunk);
+		n = huffman_decode(dec, reader, chunk, count);
+		ok = n == count && fwrite(chunk, 1, n, out) == n;
+		total -= n;
+	}
+	free(reader);
+	huffman_decoder_delete(dec);
+	return (ok);
+}
+
+/**
+ * huffman_decode_file - program that decompresses a file written by
+ * huffman_encode_file
+ * @in_path: the path of the compressed file
+ * @out_path: the path of the decompressed file
+ * Return: 1 on success, 0 on error
+ */
+
+int huffman_decode_file(const char *in_path, const char *out_path)
+{
+	huffman_table_t table;
+	size_t total;
+	FILE *in, *out = NULL;
+	int ok;
+
+	in = fopen(in_path, "rb");
+	if (!in)
+		return (0);
+	ok = huffman_read_header(in, &table, &total);
+	if (ok)
+		out = fopen(out_path, "wb");
+	ok = ok && out;
+	if (ok && total)
+		ok = huffman_decode_stream(in, out, &table, total);
+	if (out && fclose(out) != 0)
+		ok = 0;
+	fclose(in);
+	return (ok);
+}
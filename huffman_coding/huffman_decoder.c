@@ -0,0 +1,171 @@
+#include "huffman.h"
+
+/**
+ * huffman_decoder_grow - program that appends zeroed entries to the
+ * tables of a decoder
+ * @dec: a pointer to the decoder
+ * @nb_entries: the number of entries to append
+ * Return: the index of the first new entry, or (size_t)-1 on failure
+ */
+
+size_t huffman_decoder_grow(huffman_decoder_t *dec, size_t nb_entries)
+{
+	huffman_entry_t *entries;
+	size_t capacity = dec->capacity ? dec->capacity : 1;
+
+	while (capacity < dec->nb_entries + nb_entries)
+		capacity *= 2;
+	if (capacity != dec->capacity)
+	{
+		entries = realloc(dec->entries, capacity * sizeof(*entries));
+		if (!entries)
+			return ((size_t)-1);
+		dec->entries = entries;
+		dec->capacity = capacity;
+	}
+	memset(dec->entries + dec->nb_entries, 0,
+	       nb_entries * sizeof(*entries));
+	dec->nb_entries += nb_entries;
+	return (dec->nb_entries - nb_entries);
+}
+
+/**
+ * huffman_decoder_put - program that fills every entry of a table whose
+ * index starts with the rest of a code
+ * @dec: a pointer to the decoder
+ * @base: the index of the first entry of the table
+ * @i: the position of the symbol in the order of the decoder
+ * @done: the number of bits of the code consumed before the table
+ * @width: the number of bits indexing the table
+ */
+
+void huffman_decoder_put(huffman_decoder_t *dec, size_t base, size_t i,
+			 size_t done, size_t width)
+{
+	unsigned char symbol = dec->order[i];
+	size_t bits = dec->table->lengths[symbol] - done, first, k;
+	huffman_entry_t *entry;
+
+	first = (HUFFMAN_CODE(dec->table->codes[symbol]) &
+		 ((1UL << bits) - 1)) << (width - bits);
+	for (k = 0; k < 1UL << (width - bits); k++)
+	{
+		entry = dec->entries + base + first + k;
+		entry->symbols[0] = symbol;
+		entry->nb_symbols = 1;
+		entry->length = bits;
+		entry->first_length = bits;
+	}
+}
+
+/**
+ * huffman_decoder_fill - program that fills a table with the codes of a
+ * run of symbols, linking the codes too long for it to subtables
+ * The codes that share the bits of an entry are contiguous in the order
+ * of the decoder, and the longest of them is the last one
+ * @dec: a pointer to the decoder
+ * @base: the index of the first entry of the table
+ * @done: the number of bits shared by the codes and consumed before
+ * @width: the number of bits indexing the table
+ * @lo: the position of the first symbol in the order of the decoder
+ * @hi: the position past the last symbol
+ * Return: 1 on success, 0 on allocation failure
+ */
+
+int huffman_decoder_fill(huffman_decoder_t *dec, size_t base, size_t done,
+			 size_t width, size_t lo, size_t hi)
+{
+	const huffman_table_t *table = dec->table;
+	size_t i = lo, j, index, sub, link;
+
+	while (i < hi)
+	{
+		if (table->lengths[dec->order[i]] - done <= width)
+		{
+			huffman_decoder_put(dec, base, i++, done, width);
+			continue;
+		}
+		index = HUFFMAN_CODE(table->codes[dec->order[i]]) >>
+			(table->lengths[dec->order[i]] - done - width);
+		index &= (1UL << width) - 1;
+		for (j = i + 1; j < hi; j++)
+			if (((HUFFMAN_CODE(table->codes[dec->order[j]]) >>
+			      (table->lengths[dec->order[j]] - done - width)) &
+			     ((1UL << width) - 1)) != index)
+				break;
+		sub = table->lengths[dec->order[j - 1]] - done - width;
+		sub = sub < HUFFMAN_SUB_BITS ? sub : HUFFMAN_SUB_BITS;
+		link = huffman_decoder_grow(dec, 1UL << sub);
+		if (link == (size_t)-1)
+			return (0);
+		dec->entries[base + index].length = width;
+		dec->entries[base + index].sub_bits = sub;
+		dec->entries[base + index].link = link;
+		if (!huffman_decoder_fill(dec, link, done + width, sub, i, j))
+			return (0);
+		i = j;
+	}
+	return (1);
+}
+
+/**
+ * huffman_decoder_multi - program that appends to each primary entry
+ * the symbols whose whole code follows the first one within its bits
+ * @dec: a pointer to the decoder, whose primary table holds one symbol
+ * per entry
+ */
+
+void huffman_decoder_multi(huffman_decoder_t *dec)
+{
+	size_t mask = (1 << HUFFMAN_PRIMARY_BITS) - 1, i, used;
+	huffman_entry_t *entry, *next;
+
+	for (i = 0; i <= mask; i++)
+	{
+		entry = dec->entries + i;
+		used = entry->nb_symbols ? entry->first_length : 0;
+		while (used && entry->nb_symbols < HUFFMAN_ENTRY_SYMBOLS)
+		{
+			next = dec->entries + ((i << used) & mask);
+			if (!next->nb_symbols ||
+			    used + next->first_length > HUFFMAN_PRIMARY_BITS)
+				break;
+			entry->symbols[entry->nb_symbols++] = next->symbols[0];
+			used += next->first_length;
+		}
+		if (used)
+			entry->length = used;
+	}
+}
+
+/**
+ * huffman_decoder_create - program that builds the decoding tables of a
+ * canonical code
+ * @table: the code, which must outlive the decoder
+ * Return: a pointer to the decoder, or NULL on failure or if the code
+ * has no symbol
+ */
+
+huffman_decoder_t *huffman_decoder_create(const huffman_table_t *table)
+{
+	huffman_decoder_t *dec = calloc(1, sizeof(*dec));
+	size_t length, symbol;
+
+	if (!dec)
+		return (NULL);
+	dec->table = table;
+	for (length = 1; length <= table->max_length; length++)
+		for (symbol = 0; symbol < HUFFMAN_NB_SYMBOLS; symbol++)
+			if (table->lengths[symbol] == length)
+				dec->order[dec->nb_symbols++] = symbol;
+	if (!dec->nb_symbols ||
+	    huffman_decoder_grow(dec, 1 << HUFFMAN_PRIMARY_BITS) ||
+	    !huffman_decoder_fill(dec, 0, 0, HUFFMAN_PRIMARY_BITS, 0,
+				  dec->nb_symbols))
+	{
+		huffman_decoder_delete(dec);
+		return (NULL);
+	}
+	huffman_decoder_multi(dec);
+	return (dec);
+}
@@ -0,0 +1,117 @@
+#include "huffman.h"
+
+/**
+ * huffman_count_file - program that counts the occurrences of each byte
+ * value from the current position of a file to its end
+ * @file: the file to read
+ * @counts: where to store the HUFFMAN_NB_SYMBOLS counts
+ * @total: where to store the number of bytes read
+ * Return: 1 on success, 0 on read error
+ */
+
+int huffman_count_file(FILE *file, size_t *counts, size_t *total)
+{
+	unsigned char chunk[HUFFMAN_BUFFER_SIZE];
+	size_t nb_read, i;
+
+	memset(counts, 0, HUFFMAN_NB_SYMBOLS * sizeof(*counts));
+	*total = 0;
+	while ((nb_read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+	{
+		for (i = 0; i < nb_read; i++)
+			counts[chunk[i]]++;
+		*total += nb_read;
+	}
+	return (!ferror(file));
+}
+
+/**
+ * huffman_write_header - program that writes the header of an encoded
+ * file: HUFFMAN_MAGIC, the number of encoded bytes on 8 bytes, most
+ * significant first, then the code lengths of the table
+ * @file: the file to write
+ * @table: the code used for the payload
+ * @total: the number of bytes the payload decodes to
+ * Return: 1 on success, 0 on write error
+ */
+
+int huffman_write_header(FILE *file, const huffman_table_t *table,
+			 size_t total)
+{
+	unsigned char header[HUFFMAN_HEADER_SIZE];
+	size_t i;
+
+	memcpy(header, HUFFMAN_MAGIC, 4);
+	for (i = 0; i < 8; i++)
+		header[4 + i] = (unsigned long)total >> (56 - 8 * i);
+	huffman_table_serialize(table, header + 12);
+	return (fwrite(header, 1, sizeof(header), file) == sizeof(header));
+}
+
+/**
+ * huffman_encode_stream - program that encodes a file chunk by chunk,
+ * from its current position to its end
+ * @in: the file to encode
+ * @out: where to write the encoded bits
+ * @table: the code of every byte found in @in
+ * Return: 1 on success, 0 on error
+ */
+
+int huffman_encode_stream(FILE *in, FILE *out, const huffman_table_t *table)
+{
+	unsigned char chunk[HUFFMAN_BUFFER_SIZE];
+	huffman_encoder_t *enc = malloc(sizeof(*enc));
+	size_t nb_read;
+	int ok = 1;
+
+	if (!enc)
+		return (0);
+	huffman_encoder_init(enc, table, out);
+	while (ok && (nb_read = fread(chunk, 1, sizeof(chunk), in)) > 0)
+		ok = huffman_encode(enc, chunk, nb_read);
+	ok = ok && !ferror(in) && huffman_encoder_finish(enc);
+	free(enc);
+	return (ok);
+}
+
+/**
+ * huffman_encode_file - program that compresses a file with the
+ * canonical Huffman code of its bytes
+ * The input is read twice: once to count the bytes, once to encode them.
+ * Codes are limited to HUFFMAN_FILE_BITS so that the decoder resolves
+ * any of them with at most one subtable
+ * @in_path: the path of the file to compress
+ * @out_path: the path of the compressed file
+ * Return: 1 on success, 0 on error
+ */
+
+int huffman_encode_file(const char *in_path, const char *out_path)
+{
+	size_t counts[HUFFMAN_NB_SYMBOLS], freq[HUFFMAN_NB_SYMBOLS];
+	char data[HUFFMAN_NB_SYMBOLS];
+	size_t total, size = 0, i;
+	huffman_table_t table;
+	FILE *in, *out = NULL;
+	int ok;
+
+	in = fopen(in_path, "rb");
+	if (!in)
+		return (0);
+	memset(&table, 0, sizeof(table));
+	ok = huffman_count_file(in, counts, &total);
+	for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+		if (counts[i])
+			data[size] = (char)i, freq[size++] = counts[i];
+	if (ok && size)
+		ok = huffman_table_build_limited(data, freq, size,
+						 HUFFMAN_FILE_BITS, &table);
+	if (ok)
+		out = fopen(out_path, "wb");
+	ok = ok && out && huffman_write_header(out, &table, total);
+	ok = ok && fseek(in, 0, SEEK_SET) == 0;
+	ok = ok && huffman_encode_stream(in, out, &table);
+	if (out && fclose(out) != 0)
+		ok = 0;
+	fclose(in);
+	return (ok);
+}
@@ -0,0 +1,123 @@
+#include "huffman.h"
+
+/**
+ * huffman_encoder_init - program that prepares a streaming encoder
+ * @enc: a pointer to the encoder
+ * @table: the canonical code of each byte, which must outlive @enc
+ * @file: where the encoded bytes are written
+ */
+
+void huffman_encoder_init(huffman_encoder_t *enc,
+			  const huffman_table_t *table, FILE *file)
+{
+	enc->table = table;
+	enc->acc = 0;
+	enc->nb_bits = 0;
+	enc->buffered = 0;
+	enc->file = file;
+	enc->total_bits = 0;
+}
+
+/**
+ * huffman_encoder_put_word - program that stores a full accumulator,
+ * most significant byte first, and writes the buffer out when it is full
+ * @enc: a pointer to the encoder
+ * @word: the 64 bits to store
+ * Return: 1 on success, 0 if the buffer could not be written
+ */
+
+int huffman_encoder_put_word(huffman_encoder_t *enc, unsigned long word)
+{
+	unsigned char *out;
+
+	if (enc->buffered + 8 > HUFFMAN_BUFFER_SIZE)
+	{
+		if (fwrite(enc->buffer, 1, enc->buffered, enc->file) !=
+		    enc->buffered)
+			return (0);
+		enc->buffered = 0;
+	}
+	out = enc->buffer + enc->buffered;
+	out[0] = word >> 56, out[1] = word >> 48;
+	out[2] = word >> 40, out[3] = word >> 32;
+	out[4] = word >> 24, out[5] = word >> 16;
+	out[6] = word >> 8, out[7] = word;
+	enc->buffered += 8;
+	return (1);
+}
+
+/**
+ * huffman_encode - program that appends the codes of a chunk of bytes
+ * to the output of an encoder
+ * A code that does not fit in the free bits of the accumulator is split:
+ * its head completes the accumulator, which is stored as one word, and
+ * its tail starts the next one
+ * @enc: a pointer to the encoder
+ * @data: the bytes to encode
+ * @size: the number of bytes
+ * Return: 1 on success, 0 if a byte has no code or on write error
+ */
+
+int huffman_encode(huffman_encoder_t *enc, const unsigned char *data,
+		   size_t size)
+{
+	const unsigned long *codes = enc->table->codes;
+	unsigned long acc = enc->acc, code;
+	size_t nb_bits = enc->nb_bits, length, free_bits, i, total = 0;
+
+	for (i = 0; i < size; i++)
+	{
+		code = HUFFMAN_CODE(codes[data[i]]);
+		length = HUFFMAN_LENGTH(codes[data[i]]);
+		if (!length)
+			break;
+		total += length;
+		free_bits = HUFFMAN_WORD_BITS - nb_bits;
+		if (length < free_bits)
+		{
+			acc |= code << (free_bits - length);
+			nb_bits += length;
+			continue;
+		}
+		acc |= code >> (length - free_bits);
+		if (!huffman_encoder_put_word(enc, acc))
+			break;
+		nb_bits = length - free_bits;
+		acc = nb_bits ? code << (HUFFMAN_WORD_BITS - nb_bits) : 0;
+	}
+	enc->acc = acc;
+	enc->nb_bits = nb_bits;
+	enc->total_bits += total;
+	return (i == size);
+}
+
+/**
+ * huffman_encoder_finish - program that writes the bits left in an
+ * encoder, padding the last byte with zeros, and flushes its buffer
+ * @enc: a pointer to the encoder
+ * Return: 1 on success, 0 on write error
+ */
+
+int huffman_encoder_finish(huffman_encoder_t *enc)
+{
+	size_t shift = HUFFMAN_WORD_BITS;
+
+	if (enc->buffered + 8 > HUFFMAN_BUFFER_SIZE)
+	{
+		if (fwrite(enc->buffer, 1, enc->buffered, enc->file) !=
+		    enc->buffered)
+			return (0);
+		enc->buffered = 0;
+	}
+	while (enc->nb_bits)
+	{
+		shift -= 8;
+		enc->buffer[enc->buffered++] = enc->acc >> shift;
+		enc->nb_bits = enc->nb_bits > 8 ? enc->nb_bits - 8 : 0;
+	}
+	enc->acc = 0;
+	if (fwrite(enc->buffer, 1, enc->buffered, enc->file) != enc->buffered)
+		return (0);
+	enc->buffered = 0;
+	return (fflush(enc->file) == 0);
+}
@@ -1,5 +1,41 @@
 #include "huffman.h"
 
+/**
+ * huffman_combine - program that creates the parent node of two nodes,
+ * whose frequency is the sum of theirs
+ * @node1: a pointer to the left child, of lowest frequency
+ * @node2: a pointer to the right child
+ * Return: a pointer to the new node, or NULL on failure
+ */
+
+binary_tree_node_t *huffman_combine(binary_tree_node_t *node1,
+				    binary_tree_node_t *node2)
+{
+	binary_tree_node_t *node;
+	symbol_t *combined_symbol, *symbol1, *symbol2;
+
+	symbol1 = (symbol_t *)node1->data;
+	symbol2 = (symbol_t *)node2->data;
+	combined_symbol = symbol_create(-1, symbol1->freq + symbol2->freq);
+
+	if (combined_symbol == NULL)
+		return (NULL);
+
+	node = binary_tree_node(NULL, combined_symbol);
+
+	if (node == NULL)
+	{
+		free(combined_symbol);
+		return (NULL);
+	}
+	node->left = node1;
+	node->right = node2;
+	node1->parent = node;
+	node2->parent = node;
+
+	return (node);
+}
+
 /**
  * huffman_extract_and_insert - program that extracts the two nodes
  * with the lowest frequency from the priority queue, combines them
@@ -16,8 +52,7 @@
 int huffman_extract_and_insert(heap_t *priority_queue)
 {
 	void *ptr1, *ptr2;
-	binary_tree_node_t *node, *node1, *node2;
-	symbol_t *combined_symbol, *symbol1, *symbol2;
+	binary_tree_node_t *node;
 
 	ptr1 = heap_extract(priority_queue);
 	ptr2 = heap_extract(priority_queue);
@@ -25,28 +60,38 @@ int huffman_extract_and_insert(heap_t *priority_queue)
 	if (ptr1 == NULL || ptr2 == NULL)
 		return (0);
 
-	node1 = (binary_tree_node_t *)ptr1;
-	node2 = (binary_tree_node_t *)ptr2;
-	symbol1 = (symbol_t *)node1->data;
-	symbol2 = (symbol_t *)node2->data;
-	combined_symbol = symbol_create(-1, symbol1->freq + symbol2->freq);
+	node = huffman_combine(ptr1, ptr2);
 
-	if (combined_symbol == NULL)
+	if (node == NULL || heap_insert(priority_queue, node) == NULL)
+	{
 		return (0);
+	}
 
-	node = binary_tree_node(NULL, combined_symbol);
+	return (1);
+}
 
-	if (node == NULL)
-	{
-		free(combined_symbol);
+/**
+ * huffman_array_extract_and_insert - program that does the same as
+ * huffman_extract_and_insert on an array-backed priority queue
+ * @priority_queue: a pointer to the priority queue used to manage the nodes
+ *                  in the Huffman tree
+ * Return: 1 if the operation is successful, 0 otherwise
+ */
+
+int huffman_array_extract_and_insert(array_heap_t *priority_queue)
+{
+	void *ptr1, *ptr2;
+	binary_tree_node_t *node;
+
+	ptr1 = array_heap_extract(priority_queue);
+	ptr2 = array_heap_extract(priority_queue);
+
+	if (ptr1 == NULL || ptr2 == NULL)
 		return (0);
-	}
-	node->left = node1;
-	node->right = node2;
-	node1->parent = node;
-	node2->parent = node;
 
-	if (heap_insert(priority_queue, node) == NULL)
+	node = huffman_combine(ptr1, ptr2);
+
+	if (node == NULL || array_heap_insert(priority_queue, node) == NULL)
 	{
 		return (0);
 	}
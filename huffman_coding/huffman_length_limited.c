@@ -0,0 +1,153 @@
+#include "huffman.h"
+
+/**
+ * huffman_package_merge_level - program that builds one list of the
+ * package-merge algorithm: the leaves merged with the packages formed by
+ * pairing the items of the previous list, keeping the lightest items
+ * @weights: the weights of the leaves, by increasing weight
+ * @size: the number of leaves
+ * @prev: the weights of the previous list, by increasing weight
+ * @nb_prev: the number of items in @prev
+ * @next: where to store the weights of the new list
+ * @leaf: where to store, for each item of the new list, 1 if it is a
+ *        leaf and 0 if it is a package
+ * Return: the number of items in the new list, at most 2 * size - 2
+ */
+
+size_t huffman_package_merge_level(size_t *weights, size_t size,
+				   size_t *prev, size_t nb_prev,
+				   size_t *next, unsigned char *leaf)
+{
+	size_t i = 0, j = 0, n = 0, package;
+
+	while (n < 2 * size - 2 && (i < size || j + 1 < nb_prev))
+	{
+		package = j + 1 < nb_prev ? prev[j] + prev[j + 1] : 0;
+		if (i < size && (j + 1 >= nb_prev || weights[i] <= package))
+		{
+			leaf[n] = 1;
+			next[n++] = weights[i++];
+		}
+		else
+		{
+			leaf[n] = 0;
+			next[n++] = package;
+			j += 2;
+		}
+	}
+	return (n);
+}
+
+/**
+ * huffman_package_merge - program that computes optimal code lengths no
+ * longer than a limit with the package-merge algorithm
+ * The first 2 * size - 2 items of the last list are kept. Going back
+ * through the lists, the leaves among the kept items of a list are the
+ * lightest ones, and each of them gets one more bit, while every kept
+ * package keeps two items of the list below
+ * @weights: the weights of the leaves, by increasing weight
+ * @size: the number of leaves, at least 2 and at most 1 << @max_length
+ * @max_length: the maximum code length
+ * @lengths: where to store the code length of each leaf
+ * Return: 1 on success, 0 on allocation failure
+ */
+
+int huffman_package_merge(size_t *weights, size_t size, size_t max_length,
+			  unsigned char *lengths)
+{
+	size_t *block = malloc(sizeof(size_t) * 4 * size), *prev, *next, *swap;
+	size_t nb_items = 0, level, i, kept, nb_leaves;
+	unsigned char *leaf = malloc(max_length * 2 * size);
+
+	if (!block || !leaf)
+	{
+		free(block), free(leaf);
+		return (0);
+	}
+	prev = block, next = block + 2 * size;
+	for (level = 0; level < max_length; level++)
+	{
+		nb_items = huffman_package_merge_level(weights, size, prev,
+						       nb_items, next,
+						       leaf + level * 2 * size);
+		swap = prev, prev = next, next = swap;
+	}
+	memset(lengths, 0, size);
+	for (kept = 2 * size - 2, level = max_length; level-- > 0 && kept;)
+	{
+		for (i = 0, nb_leaves = 0; i < kept; i++)
+			nb_leaves += leaf[level * 2 * size + i];
+		for (i = 0; i < nb_leaves; i++)
+			lengths[i]++;
+		kept = 2 * (kept - nb_leaves);
+	}
+	free(block);
+	free(leaf);
+	return (1);
+}
+
+/**
+ * huffman_lengths_limited - program that computes the code lengths of
+ * the optimal prefix code whose codes are no longer than a limit
+ * @data: an array of characters
+ * @freq: an array of the associated frequencies
+ * @size: the size of the arrays
+ * @max_length: the maximum code length, such that 1 << @max_length is
+ *              at least @size
+ * @lengths: where to store the code length of each byte value, 0 for the
+ *           values absent from @data
+ * Return: 1 on success, 0 on failure
+ */
+
+int huffman_lengths_limited(char *data, size_t *freq, size_t size,
+			    size_t max_length, unsigned char *lengths)
+{
+	size_t *order = malloc(sizeof(size_t) * (2 * size + 1)), *weights, i;
+	unsigned char sorted[HUFFMAN_NB_SYMBOLS];
+	int ok;
+
+	if (!size || size > HUFFMAN_NB_SYMBOLS || !max_length ||
+	    (max_length < 8 && size > 1UL << max_length) || !order)
+	{
+		free(order);
+		return (0);
+	}
+	memset(lengths, 0, HUFFMAN_NB_SYMBOLS);
+	weights = order + size;
+	ok = huffman_radix_sort(freq, size, order);
+	for (i = 0; ok && i < size; i++)
+		weights[i] = freq[order[i]];
+	if (ok && size == 1)
+		sorted[0] = 1;
+	else if (ok)
+		ok = huffman_package_merge(weights, size,
+					   max_length < size - 1 ?
+					   max_length : size - 1, sorted);
+	for (i = 0; ok && i < size; i++)
+		lengths[(unsigned char)data[order[i]]] = sorted[i];
+	free(order);
+	return (ok);
+}
+
+/**
+ * huffman_table_build_limited - program that builds the canonical code
+ * table of the optimal code whose codes are no longer than a limit
+ * @data: an array of characters
+ * @freq: an array of the associated frequencies
+ * @size: the size of the arrays
+ * @max_length: the maximum code length, at most HUFFMAN_MAX_BITS
+ * @table: a pointer to the table to fill
+ * Return: 1 on success, 0 on failure
+ */
+
+int huffman_table_build_limited(char *data, size_t *freq, size_t size,
+				size_t max_length, huffman_table_t *table)
+{
+	if (max_length > HUFFMAN_MAX_BITS)
+		max_length = HUFFMAN_MAX_BITS;
+	memset(table, 0, sizeof(*table));
+	if (!huffman_lengths_limited(data, freq, size, max_length,
+				     table->lengths))
+		return (0);
+	return (huffman_canonical(table));
+}
@@ -0,0 +1,51 @@
+#include "huffman.h"
+
+/**
+ * huffman_tree_cost - program that computes the number of bits needed to
+ * encode the symbols of a Huffman tree with the codes of the tree
+ * @root: a pointer to the root of the tree, or of a subtree
+ * @depth: the depth of @root
+ * Return: the sum over the leaves of their frequency times their depth
+ */
+
+size_t huffman_tree_cost(binary_tree_node_t *root, size_t depth)
+{
+	symbol_t *symbol = (symbol_t *)root->data;
+
+	if (!root->left && !root->right)
+		return (symbol->freq * (depth ? depth : 1));
+	return ((root->left ? huffman_tree_cost(root->left, depth + 1) : 0) +
+		(root->right ? huffman_tree_cost(root->right, depth + 1) : 0));
+}
+
+/**
+ * huffman_limit_loss - program that measures what limiting the length of
+ * the codes costs against an unlimited Huffman code
+ * @data: an array of characters
+ * @freq: an array of the associated frequencies
+ * @size: the size of the arrays
+ * @max_length: the maximum code length
+ * @loss: where to store the number of extra bits needed to encode the
+ *        symbols with the limited code
+ * Return: 1 on success, 0 on failure
+ */
+
+int huffman_limit_loss(char *data, size_t *freq, size_t size,
+		       size_t max_length, size_t *loss)
+{
+	unsigned char lengths[HUFFMAN_NB_SYMBOLS];
+	huffman_flat_t *tree;
+	size_t limited = 0, i;
+
+	if (!huffman_lengths_limited(data, freq, size, max_length, lengths))
+		return (0);
+	tree = huffman_tree_linear(data, freq, size);
+	if (!tree)
+		return (0);
+	for (i = 0; i < size; i++)
+		limited += freq[i] * lengths[(unsigned char)data[i]];
+	*loss = limited - huffman_tree_cost(&tree->nodes[tree->nb_nodes - 1],
+					    0);
+	huffman_flat_delete(tree);
+	return (1);
+}
@@ -49,3 +49,41 @@ heap_t *huffman_priority_queue(char *data, size_t *freq, size_t size)
 	}
 	return (heap);
 }
+
+/**
+ * huffman_array_priority_queue - program that creates the same priority
+ * queue as huffman_priority_queue on an array-backed heap
+ * @data: an array of characters
+ * @freq: an array of frequencies associated with characters
+ * @size: the size of the arrays
+ * Return: a min-heapified version of the arrays, or NULL on failure
+ */
+
+array_heap_t *huffman_array_priority_queue(char *data, size_t *freq,
+					   size_t size)
+{
+	array_heap_t *heap;
+	symbol_t *symbol;
+	binary_tree_node_t *node;
+	size_t i;
+
+	heap = array_heap_create(compare_frequencies);
+
+	if (!heap)
+		return (NULL);
+
+	for (i = 0; i < size; i++)
+	{
+		symbol = symbol_create(data[i], freq[i]);
+		node = symbol ? binary_tree_node(NULL, symbol) : NULL;
+
+		if (!node || !array_heap_insert(heap, node))
+		{
+			free(symbol);
+			free(node);
+			array_heap_delete(heap, freeNestedNode);
+			return (NULL);
+		}
+	}
+	return (heap);
+}
@@ -0,0 +1,114 @@
+#include "huffman.h"
+
+/**
+ * huffman_code_lengths - program that stores the depth of every leaf of
+ * a Huffman tree as the code length of its symbol
+ * a tree made of a single leaf gives its symbol a 1-bit code
+ * @root: the current node in the Huffman tree
+ * @depth: the depth of @root
+ * @lengths: an array of HUFFMAN_NB_SYMBOLS lengths to fill
+ * Return: the length of the longest code below @root
+ */
+
+size_t huffman_code_lengths(binary_tree_node_t *root, size_t depth,
+			    unsigned char *lengths)
+{
+	symbol_t *symbol = (symbol_t *)root->data;
+	size_t left, right;
+
+	if (!root->left && !root->right)
+	{
+		if (depth == 0)
+			depth = 1;
+		lengths[(unsigned char)symbol->data] =
+			depth > HUFFMAN_MAX_BITS ? 0 : depth;
+		return (depth);
+	}
+	left = root->left ? huffman_code_lengths(root->left, depth + 1,
+						 lengths) : 0;
+	right = root->right ? huffman_code_lengths(root->right, depth + 1,
+						   lengths) : 0;
+	return (left > right ? left : right);
+}
+
+/**
+ * huffman_canonical - program that assigns canonical codes from the
+ * code lengths of a table
+ * @table: a pointer to the table, whose lengths are set
+ * Return: 1 on success, 0 if a length is above HUFFMAN_MAX_BITS or the
+ *         lengths do not form a prefix code
+ */
+
+int huffman_canonical(huffman_table_t *table)
+{
+	unsigned long count[HUFFMAN_MAX_BITS + 1], next[HUFFMAN_MAX_BITS + 1];
+	unsigned long code = 0, left = 1;
+	size_t i, len;
+
+	memset(count, 0, sizeof(count));
+	for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+	{
+		if (table->lengths[i] > HUFFMAN_MAX_BITS)
+			return (0);
+		count[table->lengths[i]]++;
+	}
+	count[0] = 0, table->max_length = 0;
+	for (len = 1; len <= HUFFMAN_MAX_BITS; len++)
+	{
+		left <<= 1;
+		if (count[len] > left)
+			return (0);
+		left -= count[len];
+		code = (code + count[len - 1]) << 1;
+		next[len] = code;
+		if (count[len])
+			table->max_length = len;
+	}
+	for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+	{
+		len = table->lengths[i];
+		table->codes[i] = len ? HUFFMAN_PACK(next[len]++, len) : 0;
+	}
+	return (1);
+}
+
+/**
+ * huffman_table_from_tree - program that builds the canonical code table
+ * matching the code lengths of a Huffman tree
+ * @root: the root node of the Huffman tree
+ * @table: a pointer to the table to fill
+ * Return: 1 on success, 0 if a code is longer than HUFFMAN_MAX_BITS
+ */
+
+int huffman_table_from_tree(binary_tree_node_t *root, huffman_table_t *table)
+{
+	memset(table, 0, sizeof(*table));
+	if (!root)
+		return (0);
+	if (huffman_code_lengths(root, 0, table->lengths) > HUFFMAN_MAX_BITS)
+		return (0);
+	return (huffman_canonical(table));
+}
+
+/**
+ * huffman_table_build - program that builds the canonical code table of
+ * a set of symbols and their frequencies
+ * @data: an array of characters
+ * @freq: an array of frequencies associated with characters
+ * @size: the size of the arrays
+ * @table: a pointer to the table to fill
+ * Return: 1 on success, 0 on failure
+ */
+
+int huffman_table_build(char *data, size_t *freq, size_t size,
+			huffman_table_t *table)
+{
+	huffman_flat_t *tree = huffman_tree_linear(data, freq, size);
+	int ok;
+
+	if (!tree)
+		return (0);
+	ok = huffman_table_from_tree(&tree->nodes[tree->nb_nodes - 1], table);
+	huffman_flat_delete(tree);
+	return (ok);
+}
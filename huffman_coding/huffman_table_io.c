@@ -0,0 +1,32 @@
+#include "huffman.h"
+
+/**
+ * huffman_table_serialize - program that writes the code lengths of a
+ * canonical code table, which is all a decoder needs to rebuild it
+ * @table: a pointer to the table
+ * @buf: where to write HUFFMAN_NB_SYMBOLS bytes, one length per symbol
+ * Return: the number of bytes written
+ */
+
+size_t huffman_table_serialize(const huffman_table_t *table,
+			       unsigned char *buf)
+{
+	memcpy(buf, table->lengths, HUFFMAN_NB_SYMBOLS);
+	return (HUFFMAN_NB_SYMBOLS);
+}
+
+/**
+ * huffman_table_deserialize - program that rebuilds a canonical code
+ * table from the lengths written by huffman_table_serialize
+ * @buf: the HUFFMAN_NB_SYMBOLS lengths
+ * @table: a pointer to the table to fill
+ * Return: 1 on success, 0 if the lengths are not a valid code
+ */
+
+int huffman_table_deserialize(const unsigned char *buf,
+			      huffman_table_t *table)
+{
+	memset(table, 0, sizeof(*table));
+	memcpy(table->lengths, buf, HUFFMAN_NB_SYMBOLS);
+	return (huffman_canonical(table));
+}
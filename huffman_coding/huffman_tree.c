@@ -38,29 +38,28 @@ void freeNestedNode(void *data)
 
 binary_tree_node_t *huffman_tree(char *data, size_t *freq, size_t size)
 {
-	heap_t *priority_queue = NULL;
+	array_heap_t *priority_queue = NULL;
 	binary_tree_node_t *huffman_root = NULL;
 
 	if (!data || !freq || size == 0)
 		return (NULL);
 
-	priority_queue = huffman_priority_queue(data, freq, size);
+	priority_queue = huffman_array_priority_queue(data, freq, size);
 
 	if (!priority_queue)
 		return (NULL);
 
-	while (priority_queue->root && (priority_queue->root->left ||
-					priority_queue->root->right))
+	while (priority_queue->size > 1)
 	{
-		if (!huffman_extract_and_insert(priority_queue))
+		if (!huffman_array_extract_and_insert(priority_queue))
 		{
-			heap_delete(priority_queue, freeNestedNode);
+			array_heap_delete(priority_queue, freeNestedNode);
 			return (NULL);
 		}
 	}
 
-	huffman_root = (binary_tree_node_t *)(priority_queue->root->data);
-	heap_delete(priority_queue, NULL);
+	huffman_root = (binary_tree_node_t *)(priority_queue->items[0]);
+	array_heap_delete(priority_queue, NULL);
 
 	return (huffman_root);
 }
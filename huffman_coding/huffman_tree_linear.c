@@ -0,0 +1,155 @@
+#include "huffman.h"
+
+/**
+ * huffman_radix_sort - program that sorts symbols by frequency with a
+ * stable least significant digit radix sort
+ * passes whose digit is the same for every frequency are skipped
+ * @freq: an array of frequencies
+ * @size: the size of the array
+ * @order: where to store the indexes of the symbols, by increasing
+ *         frequency, equal frequencies keeping their original order
+ * Return: 1 on success, 0 on failure
+ */
+
+int huffman_radix_sort(size_t *freq, size_t size, size_t *order)
+{
+	size_t count[(1 << HUFFMAN_RADIX_BITS) + 1], *tmp, *src, *dst, *swap;
+	size_t i, d, shift, mask = (1 << HUFFMAN_RADIX_BITS) - 1;
+
+	tmp = malloc(sizeof(size_t) * (size + 1));
+	if (!tmp)
+		return (0);
+	for (i = 0; i < size; i++)
+		order[i] = i;
+	src = order, dst = tmp;
+	for (shift = 0; shift < sizeof(size_t) * 8;
+	     shift += HUFFMAN_RADIX_BITS)
+	{
+		memset(count, 0, sizeof(count));
+		for (i = 0; i < size; i++)
+			count[((freq[i] >> shift) & mask) + 1]++;
+		if (count[((freq[0] >> shift) & mask) + 1] == size)
+			continue;
+		for (d = 0; d < mask + 1; d++)
+			count[d + 1] += count[d];
+		for (i = 0; i < size; i++)
+			dst[count[(freq[src[i]] >> shift) & mask]++] = src[i];
+		swap = src, src = dst, dst = swap;
+	}
+	if (src != order)
+		memcpy(order, src, sizeof(size_t) * size);
+	free(tmp);
+	return (1);
+}
+
+/**
+ * huffman_flat_create - program that allocates the nodes of a flat
+ * Huffman tree in two blocks
+ * @size: the number of symbols
+ * Return: a pointer to the tree, or NULL on failure
+ */
+
+huffman_flat_t *huffman_flat_create(size_t size)
+{
+	huffman_flat_t *tree = calloc(1, sizeof(huffman_flat_t));
+
+	if (!tree)
+		return (NULL);
+	tree->nb_nodes = 2 * size - 1;
+	tree->nodes = calloc(tree->nb_nodes, sizeof(binary_tree_node_t));
+	tree->symbols = malloc(sizeof(symbol_t) * tree->nb_nodes);
+	if (!tree->nodes || !tree->symbols)
+	{
+		huffman_flat_delete(tree);
+		return (NULL);
+	}
+	return (tree);
+}
+
+/**
+ * huffman_flat_delete - program that frees a flat Huffman tree
+ * @tree: a pointer to the tree
+ * Return: nothing (void)
+ */
+
+void huffman_flat_delete(huffman_flat_t *tree)
+{
+	if (!tree)
+		return;
+	free(tree->nodes);
+	free(tree->symbols);
+	free(tree);
+}
+
+/**
+ * huffman_two_queue_pick - program that takes the node of lowest
+ * frequency from the front of the leaf queue or of the merged queue
+ * leaves win ties, which keeps the tree as shallow as possible
+ * @tree: a pointer to the tree being built
+ * @leaf: a pointer to the front of the leaf queue
+ * @nb_leaves: the number of leaves
+ * @node: a pointer to the front of the merged queue
+ * @end: the index following the last merged node
+ * Return: the index of the node taken
+ */
+
+size_t huffman_two_queue_pick(huffman_flat_t *tree, size_t *leaf,
+			      size_t nb_leaves, size_t *node, size_t end)
+{
+	if (*leaf < nb_leaves && (*node == end ||
+				  tree->symbols[*leaf].freq <=
+				  tree->symbols[*node].freq))
+		return ((*leaf)++);
+	return ((*node)++);
+}
+
+/**
+ * huffman_tree_linear - program that constructs a Huffman tree in linear
+ * time once the frequencies are sorted
+ * merged nodes are created with non-decreasing frequencies, so a second
+ * FIFO queue keeps them sorted without any heap
+ * the total cost is that of huffman_tree, but ties are not broken the
+ * same way, so the code lengths can differ when frequencies tie
+ * @data: an array of characters
+ * @freq: an array of frequencies associated with characters
+ * @size: the size of the arrays
+ * Return: a pointer to the tree, whose root is its last node,
+ *         or NULL on failure
+ */
+
+huffman_flat_t *huffman_tree_linear(char *data, size_t *freq, size_t size)
+{
+	huffman_flat_t *tree;
+	size_t *order, i, leaf = 0, node = size, a, b;
+
+	if (!data || !freq || size == 0)
+		return (NULL);
+	tree = huffman_flat_create(size);
+	order = malloc(sizeof(size_t) * size);
+	if (!tree || !order || !huffman_radix_sort(freq, size, order))
+	{
+		free(order);
+		huffman_flat_delete(tree);
+		return (NULL);
+	}
+	for (i = 0; i < size; i++)
+	{
+		tree->symbols[i].data = data[order[i]];
+		tree->symbols[i].freq = freq[order[i]];
+		tree->nodes[i].data = &tree->symbols[i];
+	}
+	for (i = size; i < tree->nb_nodes; i++)
+	{
+		a = huffman_two_queue_pick(tree, &leaf, size, &node, i);
+		b = huffman_two_queue_pick(tree, &leaf, size, &node, i);
+		tree->symbols[i].data = -1;
+		tree->symbols[i].freq = tree->symbols[a].freq +
+			tree->symbols[b].freq;
+		tree->nodes[i].data = &tree->symbols[i];
+		tree->nodes[i].left = &tree->nodes[a];
+		tree->nodes[i].right = &tree->nodes[b];
+		tree->nodes[a].parent = tree->nodes[b].parent = &tree->nodes[i];
+	}
+	free(order);
+	return (tree);
+}
@@ -0,0 +1,82 @@
+#include "../huffman.h"
+#include <time.h>
+
+/*
+ * Command line driver of huffman_encode_file and huffman_decode_file,
+ * which prints the time taken and the throughput on the uncompressed
+ * side, in MB of 10^6 bytes per second:
+ *	huffman_cli encode <input> <output>
+ *	huffman_cli decode <input> <output>
+ * Build it from huffman_coding/ with the sources of the directory and of
+ * heap/:
+ * gcc -O2 -Wall -Werror -Wextra -pedantic -std=gnu89 -I. -Iheap
+ *	tests/huffman_cli.c [sources] -o huffman_cli
+ */
+
+/**
+ * bench_now - reads a monotonic clock
+ * Return: the time in seconds
+ */
+
+double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * file_size - gets the size of a file
+ * @path: the path of the file
+ * Return: the number of bytes of the file, -1 on error
+ */
+
+long file_size(const char *path)
+{
+	FILE *file = fopen(path, "rb");
+	long size = -1;
+
+	if (!file)
+		return (-1);
+	if (fseek(file, 0, SEEK_END) == 0)
+		size = ftell(file);
+	fclose(file);
+	return (size);
+}
+
+/**
+ * main - encodes or decodes a file and prints the throughput
+ * @ac: the number of arguments
+ * @av: the arguments: the mode, the input path and the output path
+ * Return: EXIT_SUCCESS on success, EXIT_FAILURE otherwise
+ */
+
+int main(int ac, char **av)
+{
+	int encode = ac == 4 && !strcmp(av[1], "encode");
+	int ok = encode || (ac == 4 && !strcmp(av[1], "decode"));
+	long in_size, out_size, plain;
+	double t0, t;
+
+	if (!ok)
+	{
+		fprintf(stderr, "usage: %s encode|decode <input> <output>\n",
+			av[0]);
+		return (EXIT_FAILURE);
+	}
+	t0 = bench_now();
+	ok = encode ? huffman_encode_file(av[2], av[3]) :
+		huffman_decode_file(av[2], av[3]);
+	t = bench_now() - t0;
+	if (!ok)
+	{
+		fprintf(stderr, "%s: cannot %s %s\n", av[0], av[1], av[2]);
+		return (EXIT_FAILURE);
+	}
+	in_size = file_size(av[2]), out_size = file_size(av[3]);
+	plain = encode ? in_size : out_size;
+	printf("%sd %ld bytes into %ld in %.3f s: %.1f MB/s\n", av[1],
+	       in_size, out_size, t, t > 0 ? plain / t / 1e6 : 0.0);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,183 @@
+#include "../huffman.h"
+#include <time.h>
+
+/*
+ * Times huffman_decode, which resolves up to HUFFMAN_ENTRY_SYMBOLS
+ * symbols per table lookup, against a decoder reading one bit at a time
+ * the way a walk down the tree does, on the files given as arguments.
+ * Each file is encoded with huffman_encode_file, then both decoders turn
+ * the whole payload into a buffer, and their output is compared with the
+ * file. Throughputs are on the decoded side, in MB of 10^6 bytes per
+ * second of processor time. Build it from huffman_coding/ with the
+ * sources of the directory and of heap/, then run it on one or more
+ * files:
+ * gcc -O2 -Wall -Werror -Wextra -pedantic -std=gnu89 -I. -Iheap
+ *	tests/huffman_decode_bench.c [sources] -o decode_bench
+ */
+
+#define HUF_PATH "decode_bench.huf"
+
+/**
+ * read_file - reads a whole file
+ * @path: the path of the file
+ * @size: where to store the number of bytes read
+ * Return: the bytes read, NULL on error
+ */
+
+unsigned char *read_file(const char *path, size_t *size)
+{
+	FILE *file = fopen(path, "rb");
+	unsigned char *data = NULL;
+	long end;
+
+	if (!file)
+		return (NULL);
+	if (fseek(file, 0, SEEK_END) == 0 && (end = ftell(file)) >= 0 &&
+	    fseek(file, 0, SEEK_SET) == 0)
+		data = malloc(end + 1);
+	*size = data ? fread(data, 1, end, file) : 0;
+	if (data && *size != (size_t)end)
+		free(data), data = NULL;
+	fclose(file);
+	return (data);
+}
+
+/**
+ * bit_decode - decodes a payload one bit at a time, comparing the code
+ * read so far with the first code of each length
+ * @dec: the decoder of the payload, whose symbol order is used
+ * @in: the payload
+ * @size: the number of bytes of @in
+ * @out: where to store the decoded bytes
+ * @total: the number of bytes to decode
+ * Return: the number of bytes decoded
+ */
+
+size_t bit_decode(const huffman_decoder_t *dec, const unsigned char *in,
+		  size_t size, unsigned char *out, size_t total)
+{
+	size_t count[HUFFMAN_MAX_BITS + 1], n, pos = 0, len, i;
+	unsigned long code, first, index;
+
+	memset(count, 0, sizeof(count));
+	for (i = 0; i < HUFFMAN_NB_SYMBOLS; i++)
+		count[dec->table->lengths[i]]++;
+	for (n = 0; n < total; n++)
+	{
+		code = first = index = 0;
+		for (len = 1; len <= dec->table->max_length; len++)
+		{
+			if (pos >= size * 8)
+				return (n);
+			code |= (in[pos >> 3] >> (7 - (pos & 7))) & 1, pos++;
+			if (code - first < count[len])
+				break;
+			index += count[len], first += count[len];
+			first <<= 1, code <<= 1;
+		}
+		if (len > dec->table->max_length)
+			return (n);
+		out[n] = dec->order[index + code - first];
+	}
+	return (n);
+}
+
+/**
+ * time_decoders - times both decoders on a payload and prints a row
+ * @dec: the decoder of the payload
+ * @file: the encoded file, at the first byte of the payload
+ * @huf: the encoded file, header included
+ * @huf_size: the number of bytes of @huf
+ * @plain: the bytes the payload decodes to
+ * @size: the number of bytes of @plain
+ * Return: 1 if both decoders gave back @plain, 0 otherwise
+ */
+
+int time_decoders(const huffman_decoder_t *dec, FILE *file,
+		  const unsigned char *huf, size_t huf_size,
+		  const unsigned char *plain, size_t size)
+{
+	unsigned char *out = malloc(size);
+	huffman_reader_t *reader = malloc(sizeof(*reader));
+	clock_t c[3];
+	int ok = out && reader;
+
+	if (ok)
+	{
+		huffman_reader_init(reader, file);
+		c[0] = clock();
+		ok = huffman_decode(dec, reader, out, size) == size &&
+			!memcmp(out, plain, size);
+		c[1] = clock();
+		ok = bit_decode(dec, huf + HUFFMAN_HEADER_SIZE,
+				huf_size - HUFFMAN_HEADER_SIZE, out, size) ==
+			size && !memcmp(out, plain, size) && ok;
+		c[2] = clock();
+		printf("%11lu %10.1f %10.1f %8.1fx\n", (unsigned long)size,
+		       size / 1e6 * CLOCKS_PER_SEC / (c[1] - c[0] + 1),
+		       size / 1e6 * CLOCKS_PER_SEC / (c[2] - c[1] + 1),
+		       (double)(c[2] - c[1] + 1) / (c[1] - c[0] + 1));
+	}
+	free(out), free(reader);
+	return (ok);
+}
+
+/**
+ * bench_file - encodes a file and times both decoders on it
+ * @path: the path of the file
+ * Return: 1 if both decoders gave back the file, 0 otherwise
+ */
+
+int bench_file(const char *path)
+{
+	unsigned char *plain, *huf = NULL;
+	size_t size = 0, huf_size = 0, total;
+	huffman_table_t table;
+	huffman_decoder_t *dec = NULL;
+	FILE *file = NULL;
+	int ok = 0;
+
+	printf("%-24s ", path);
+	plain = read_file(path, &size);
+	if (plain && size && huffman_encode_file(path, HUF_PATH))
+		huf = read_file(HUF_PATH, &huf_size);
+	if (huf)
+		file = fopen(HUF_PATH, "rb");
+	if (file && huffman_read_header(file, &table, &total) &&
+	    total == size)
+		dec = huffman_decoder_create(&table);
+	if (dec)
+		ok = time_decoders(dec, file, huf, huf_size, plain, size);
+	else
+		printf("cannot be encoded\n");
+	if (file)
+		fclose(file);
+	free(plain), free(huf);
+	huffman_decoder_delete(dec);
+	remove(HUF_PATH);
+	return (ok);
+}
+
+/**
+ * main - runs the benchmark on every file given
+ * @ac: the number of arguments
+ * @av: the arguments, the paths of the files
+ * Return: EXIT_SUCCESS if both decoders gave back every file,
+ *         EXIT_FAILURE otherwise
+ */
+
+int main(int ac, char **av)
+{
+	int i, bad = 0;
+
+	if (ac < 2)
+	{
+		fprintf(stderr, "usage: %s <file>...\n", av[0]);
+		return (EXIT_FAILURE);
+	}
+	printf("%-24s %11s %10s %10s %9s\n", "file", "bytes", "table MB/s",
+	       "bit MB/s", "speedup");
+	for (i = 1; i < ac; i++)
+		bad += !bench_file(av[i]);
+	return (bad ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -0,0 +1,149 @@
+#include "../huffman.h"
+
+/*
+ * Round trip of huffman_encode_file and huffman_decode_file, and
+ * rejection of truncated payloads. Build it from huffman_coding/ with
+ * the sources of the directory and of heap/, then run it:
+ * gcc -Wall -Werror -Wextra -pedantic -std=gnu89 -I. -Iheap
+ *	tests/huffman_round_trip.c [sources] -o round_trip
+ */
+
+#define IN_PATH "round_trip.in"
+#define HUF_PATH "round_trip.huf"
+#define OUT_PATH "round_trip.out"
+
+/**
+ * write_file - writes a buffer to a file
+ * @path: the path of the file
+ * @data: the bytes to write
+ * @size: the number of bytes
+ * Return: 1 on success, 0 on error
+ */
+
+int write_file(const char *path, const unsigned char *data, size_t size)
+{
+	FILE *file = fopen(path, "wb");
+	int ok;
+
+	if (!file)
+		return (0);
+	ok = fwrite(data, 1, size, file) == size;
+	return (fclose(file) == 0 && ok);
+}
+
+/**
+ * read_file - reads a whole file
+ * @path: the path of the file
+ * @size: where to store the number of bytes read
+ * Return: the bytes read, NULL on error
+ */
+
+unsigned char *read_file(const char *path, size_t *size)
+{
+	FILE *file = fopen(path, "rb");
+	unsigned char *data = NULL;
+	long end;
+
+	if (!file)
+		return (NULL);
+	if (fseek(file, 0, SEEK_END) == 0 && (end = ftell(file)) >= 0 &&
+	    fseek(file, 0, SEEK_SET) == 0)
+		data = malloc(end + 1);
+	*size = data ? fread(data, 1, end, file) : 0;
+	if (data && *size != (size_t)end)
+		free(data), data = NULL;
+	fclose(file);
+	return (data);
+}
+
+/**
+ * truncations_fail - checks that the encoded file cut at several lengths,
+ * all of its last bytes included, fails to decode
+ * @huf: the encoded file
+ * @size: the size of @huf
+ * Return: the number of truncations that decoded
+ */
+
+int truncations_fail(const unsigned char *huf, size_t size)
+{
+	size_t len;
+	int bad = 0;
+
+	for (len = size; len-- > 0;)
+	{
+		if (!write_file(HUF_PATH, huf, len) ||
+		    huffman_decode_file(HUF_PATH, OUT_PATH))
+		{
+			printf("  truncated to %lu bytes: decoded\n",
+			       (unsigned long)len);
+			bad++;
+		}
+		if (size - len >= 32 && len > 1009)
+			len -= 1008;
+	}
+	return (bad);
+}
+
+/**
+ * round_trip - encodes and decodes a buffer, then checks that truncated
+ * encodings of it are rejected
+ * @name: the name of the case
+ * @data: the bytes to encode
+ * @size: the number of bytes
+ * Return: the number of failed checks
+ */
+
+int round_trip(const char *name, const unsigned char *data, size_t size)
+{
+	unsigned char *huf, *out = NULL;
+	size_t huf_size = 0, out_size = 0;
+	int bad = 0;
+
+	if (!write_file(IN_PATH, data, size) ||
+	    !huffman_encode_file(IN_PATH, HUF_PATH) ||
+	    !huffman_decode_file(HUF_PATH, OUT_PATH) ||
+	    !(out = read_file(OUT_PATH, &out_size)) || out_size != size ||
+	    memcmp(out, data, size))
+		bad++;
+	free(out);
+	huf = bad ? NULL : read_file(HUF_PATH, &huf_size);
+	if (!bad && !huf)
+		bad++;
+	if (huf && size)
+		bad += truncations_fail(huf, huf_size);
+	free(huf);
+	printf("%s: %lu bytes, %lu encoded, %s\n", name, (unsigned long)size,
+	       (unsigned long)huf_size, bad ? "KO" : "OK");
+	return (bad);
+}
+
+/**
+ * main - runs the round trips on skewed, uniform, text and degenerate
+ * inputs, the larger ones spanning several HUFFMAN_BUFFER_SIZE chunks
+ * Return: EXIT_SUCCESS if every check passed, EXIT_FAILURE otherwise
+ */
+
+int main(void)
+{
+	static unsigned char data[200000];
+	const char *text = "the quick brown fox jumps over the lazy dog. ";
+	size_t i, len = strlen(text);
+	int bad = 0;
+
+	srand(98);
+	for (i = 0; i < sizeof(data); i++)
+		data[i] = rand() % 3 ? 'a' : (unsigned char)(rand() % 256);
+	bad += round_trip("skewed", data, sizeof(data));
+	for (i = 0; i < sizeof(data); i++)
+		data[i] = (unsigned char)rand();
+	bad += round_trip("uniform", data, sizeof(data));
+	for (i = 0; i < sizeof(data); i++)
+		data[i] = text[(i + i / 7) % len];
+	bad += round_trip("text", data, sizeof(data));
+	memset(data, 'z', 1000);
+	bad += round_trip("one symbol", data, 1000);
+	bad += round_trip("one byte", data, 1);
+	bad += round_trip("empty", data, 0);
+	remove(IN_PATH), remove(HUF_PATH), remove(OUT_PATH);
+	return (bad ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -0,0 +1,157 @@
+#include "../huffman.h"
+#include <time.h>
+
+/*
+ * Times the three Huffman tree builds on alphabets of 2^8 to 2^20
+ * symbols with random frequencies from 1 to 100000: the former
+ * huffman_tree on the pointer-based heap_t, whose insertions walk the
+ * heap breadth first, huffman_tree on the array heap, and
+ * huffman_tree_linear. The data of a symbol is a char, so a real
+ * alphabet has at most 256 symbols; the builds only carry it, so larger
+ * alphabets repeat the 256 values and measure the construction alone.
+ * The heap_t build grows faster than n^2, so it only runs up to the size
+ * given as first argument (1024 by default). Build it from
+ * huffman_coding/ with the sources of the directory and of heap/, then
+ * run it:
+ * gcc -O2 -Wall -Werror -Wextra -pedantic -std=gnu89 -I. -Iheap
+ *	tests/huffman_tree_bench.c [sources] -o tree_bench
+ */
+
+/**
+ * bench_now - reads a monotonic clock
+ * Return: the time in seconds
+ */
+
+double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * list_heap_tree - the former huffman_tree, on the pointer-based heap_t
+ * @data: an array of characters
+ * @freq: an array of frequencies associated with characters
+ * @size: the size of the arrays
+ * Return: a pointer to the root of the tree, or NULL on failure
+ */
+
+binary_tree_node_t *list_heap_tree(char *data, size_t *freq, size_t size)
+{
+	heap_t *priority_queue = huffman_priority_queue(data, freq, size);
+	binary_tree_node_t *root;
+
+	if (!priority_queue)
+		return (NULL);
+	while (priority_queue->root && (priority_queue->root->left ||
+					priority_queue->root->right))
+	{
+		if (!huffman_extract_and_insert(priority_queue))
+		{
+			heap_delete(priority_queue, freeNestedNode);
+			return (NULL);
+		}
+	}
+	root = priority_queue->root->data;
+	heap_delete(priority_queue, NULL);
+	return (root);
+}
+
+/**
+ * time_build - times one build of a Huffman tree, then frees the tree
+ * @which: 0 for list_heap_tree, 1 for huffman_tree, 2 for
+ *         huffman_tree_linear
+ * @data: an array of characters
+ * @freq: an array of frequencies associated with characters
+ * @size: the size of the arrays
+ * @total: where to store the frequency of the root, 0 on failure
+ * Return: the time taken in milliseconds
+ */
+
+double time_build(int which, char *data, size_t *freq, size_t size,
+		  size_t *total)
+{
+	binary_tree_node_t *root;
+	huffman_flat_t *flat = NULL;
+	double t0 = bench_now(), t;
+
+	if (which == 0)
+		root = list_heap_tree(data, freq, size);
+	else if (which == 1)
+		root = huffman_tree(data, freq, size);
+	else
+	{
+		flat = huffman_tree_linear(data, freq, size);
+		root = flat ? &flat->nodes[flat->nb_nodes - 1] : NULL;
+	}
+	t = bench_now() - t0;
+	*total = root ? ((symbol_t *)root->data)->freq : 0;
+	if (flat)
+		huffman_flat_delete(flat);
+	else
+		free_huffman_tree(root);
+	return (t * 1000);
+}
+
+/**
+ * bench_size - times the builds on one alphabet and prints a row
+ * @size: the number of symbols
+ * @list_max: the largest alphabet the heap_t build runs on
+ * Return: 1 if every tree has the total frequency at its root, 0 otherwise
+ */
+
+int bench_size(size_t size, size_t list_max)
+{
+	char *data = malloc(size);
+	size_t *freq = malloc(sizeof(size_t) * size), sum = 0, total[3], i;
+	double t[3] = {-1, -1, -1};
+	int which, ok = data && freq;
+
+	for (i = 0; ok && i < size; i++)
+	{
+		data[i] = (char)i;
+		freq[i] = rand() % 100000 + 1;
+		sum += freq[i];
+	}
+	for (which = size > list_max; ok && which < 3; which++)
+	{
+		t[which] = time_build(which, data, freq, size, &total[which]);
+		ok = total[which] == sum;
+	}
+	printf("%8lu", (unsigned long)size);
+	for (which = 0; which < 3; which++)
+		if (t[which] < 0)
+			printf(" %12s", "skipped");
+		else
+			printf(" %12.2f", t[which]);
+	printf("\n");
+	free(data), free(freq);
+	return (ok);
+}
+
+/**
+ * main - runs the benchmark
+ * @ac: the number of arguments
+ * @av: the arguments, the optional largest alphabet the heap_t build
+ *      runs on
+ * Return: EXIT_SUCCESS if every tree was built, EXIT_FAILURE otherwise
+ */
+
+int main(int ac, char **av)
+{
+	size_t list_max = ac > 1 ? strtoul(av[1], NULL, 10) : 1024;
+	size_t size;
+
+	srand(21);
+	printf("%8s %12s %12s %12s\n", "symbols", "heap_t (ms)",
+	       "array (ms)", "linear (ms)");
+	for (size = 1 << 8; size <= 1 << 20; size <<= 2)
+		if (!bench_size(size, list_max))
+		{
+			printf("a build failed\n");
+			return (EXIT_FAILURE);
+		}
+	return (EXIT_SUCCESS);
+}
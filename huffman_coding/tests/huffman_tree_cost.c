@@ -0,0 +1,94 @@
+#include "../huffman.h"
+
+/*
+ * Checks that huffman_tree_linear builds trees of the same total cost,
+ * the sum of the frequency times the depth of every symbol, as
+ * huffman_tree. Leaves win ties in the linear build, while the heap
+ * build breaks them by heap position, so the code lengths, and thus
+ * the codes of huffman_table_build, can differ when frequencies tie:
+ * the test counts those cases too. Build it from huffman_coding/ with
+ * the sources of the directory and of heap/, then run it:
+ * gcc -Wall -Werror -Wextra -pedantic -std=gnu89 -I. -Iheap
+ *	tests/huffman_tree_cost.c [sources] -o tree_cost
+ */
+
+#define NB_CASES 2000
+
+/**
+ * tree_cost - computes the total cost of a Huffman tree
+ * @root: the current node in the tree
+ * @depth: the depth of @root
+ * Return: the sum of the frequency times the depth of the leaves below
+ *         @root
+ */
+
+size_t tree_cost(binary_tree_node_t *root, size_t depth)
+{
+	if (!root->left && !root->right)
+		return (((symbol_t *)root->data)->freq * depth);
+	return ((root->left ? tree_cost(root->left, depth + 1) : 0) +
+		(root->right ? tree_cost(root->right, depth + 1) : 0));
+}
+
+/**
+ * check_case - builds both trees of one set of symbols and compares them
+ * @data: an array of distinct characters
+ * @freq: an array of frequencies associated with characters
+ * @size: the size of the arrays
+ * @differ: incremented when the code lengths of the trees differ
+ * Return: 1 if both trees have the same cost, 0 otherwise
+ */
+
+int check_case(char *data, size_t *freq, size_t size, size_t *differ)
+{
+	binary_tree_node_t *root = huffman_tree(data, freq, size), *lroot;
+	huffman_flat_t *flat = huffman_tree_linear(data, freq, size);
+	unsigned char lengths[HUFFMAN_NB_SYMBOLS];
+	unsigned char linear_lengths[HUFFMAN_NB_SYMBOLS];
+	int ok = root && flat;
+
+	if (ok)
+	{
+		lroot = &flat->nodes[flat->nb_nodes - 1];
+		ok = tree_cost(root, 0) == tree_cost(lroot, 0);
+		memset(lengths, 0, sizeof(lengths));
+		memset(linear_lengths, 0, sizeof(linear_lengths));
+		huffman_code_lengths(root, 0, lengths);
+		huffman_code_lengths(lroot, 0, linear_lengths);
+		if (memcmp(lengths, linear_lengths, sizeof(lengths)))
+			(*differ)++;
+	}
+	free_huffman_tree(root);
+	huffman_flat_delete(flat);
+	return (ok);
+}
+
+/**
+ * main - compares both builds on random alphabets of 1 to 256 symbols,
+ * whose frequencies are drawn from ranges small enough to tie often
+ * Return: EXIT_SUCCESS if every pair of trees has the same cost,
+ *         EXIT_FAILURE otherwise
+ */
+
+int main(void)
+{
+	char data[HUFFMAN_NB_SYMBOLS];
+	size_t freq[HUFFMAN_NB_SYMBOLS], size, range, i, differ = 0;
+	int c, bad = 0;
+
+	srand(22);
+	for (c = 0; c < NB_CASES; c++)
+	{
+		size = rand() % HUFFMAN_NB_SYMBOLS + 1;
+		range = c % 2 ? 4 : (size_t)rand() % 100000 + 1;
+		for (i = 0; i < size; i++)
+		{
+			data[i] = (char)i;
+			freq[i] = rand() % range + 1;
+		}
+		bad += !check_case(data, freq, size, &differ);
+	}
+	printf("%d cases: %d of different cost, %lu of different lengths\n",
+	       NB_CASES, bad, (unsigned long)differ);
+	return (bad ? EXIT_FAILURE : EXIT_SUCCESS);
+}
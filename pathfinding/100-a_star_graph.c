@@ -1,185 +1,111 @@
 #include "pathfinding.h"
 
 /**
- * get_min_g_score - finds the vertex with lowest g_score from source
+ * a_star_estimate - estimates the cost from a vertex to the target with
+ * the heuristic selected in a query context
  *
- * @graph: pointer to graph
- * @g_score: array of g_scores from start vertex
- * @visited: array of if vertex has been visited
- * @index: current index
+ * @ctx: query context
+ * @v: vertex to estimate from
+ * @target: target vertex
  *
- * Return: index with minimum g_score or NULL
+ * Return: the estimated cost
  */
-vertex_t *get_min_g_score(graph_t *graph, size_t *g_score, size_t *visited,
-		size_t *index)
+size_t a_star_estimate(dijkstra_ctx_t const *ctx, vertex_t const *v,
+	vertex_t const *target)
 {
-	size_t min = ULONG_MAX;
-	size_t i;
-	vertex_t *vertex;
-
-	vertex = graph->vertices;
-	if (vertex == NULL)
-		return (NULL);
-
-	*index = ULONG_MAX;
-
-	for (i = 0; i < graph->nb_vertices; i++)
-	{
-		if (visited[i] == 0 && min > g_score[i])
-		{
-			min = g_score[i];
-			*index = i;
-		}
-	}
-	if (*index == ULONG_MAX)
-		return (NULL);
-
-	while (vertex->next)
-	{
-		if (vertex->index == *index)
-			return (vertex);
-		vertex = vertex->next;
-	}
-	return (vertex);
+	if (ctx->heuristic)
+		return (ctx->heuristic(v, target, ctx->heuristic_param));
+	return (h(v->x, v->y, target->x, target->y));
 }
 
-
 /**
- * reconstruct_path - inserts vertices into queue
+ * a_star_relax - relaxes the edges of a closed vertex
+ * A shorter way to an already closed vertex still updates its g_score
+ * and came_from vertex, but does not reopen it
  *
- * @graph: pointer to graph with vertices
- * @path: pointer to path array
- * @came_from: pointer to came_from node
- * @start: start vertex
+ * @ctx: query context, whose dists hold the g_scores
+ * @j: index of the closed vertex
  * @target: target vertex
- *
- * Return: void
  */
-void reconstruct_path(graph_t *graph, queue_t *path, vertex_t **came_from,
-			vertex_t const *start, vertex_t const *target)
+void a_star_relax(dijkstra_ctx_t *ctx, size_t j, vertex_t const *target)
 {
-	size_t i = target->index;
-
-	if (!came_from[i])
-		return;
-
-	/* Push into queue starting at end (target node) */
-	if (!queue_push_front(path, strdup(target->content)))
-		queue_delete(path);
+	edge_t *edge;
+	size_t k;
+	int g, closed;
 
-	while (came_from[i] && i < graph->nb_vertices)
+	for (edge = ctx->verts[j]->edges; edge; edge = edge->next)
 	{
-		if (!queue_push_front(path, strdup(came_from[i]->content)))
-			queue_delete(path);
-		i = came_from[i]->index;
-		if (i == start->index)
-			return;
+		k = edge->dest->index, g = ctx->dists[j] + edge->weight;
+		closed = dijkstra_settled(ctx, k);
+		if (g >= dijkstra_dist(ctx, k))
+			continue;
+		ctx->stamps[k] = ctx->generation;
+		ctx->dists[k] = g, ctx->from[k] = ctx->verts[j];
+		if (!closed)
+			min_heap_push(&ctx->heap, k,
+				g + a_star_estimate(ctx, edge->dest, target));
 	}
 }
 
-
 /**
- * recursive_a_star - recursive utility to find shortest path using A-star
+ * a_star_search - expands vertices in order of lowest f_score, ties going
+ * to the lowest index, until the target vertex is closed
+ * The open set is the context's indexed heap, and a vertex is closed
+ * once it has been popped from it
  *
+ * @ctx: query context
  * @graph: pointer to graph to go through
- * @g_score: array of g_scores from start vertex
- * @visited: keeps track of which vertices have been visited
- * @came_from: keeps track of came_from nodes for each vertex
  * @start: pointer to starting vertex
  * @target: pointer to target vertex
- * @f_score: array of distance from start + euclidean to target
- * @idx: pointer to current index
  *
- * Return: queue of shortest path or NULL
+ * Return: 1 if @target was reached, 0 otherwise, -1 on failure
  */
-void recursive_a_star(graph_t *graph, size_t *visited, vertex_t **came_from,
-	vertex_t const *start, vertex_t const *target,
-	size_t *f_score, size_t *g_score, size_t idx)
+int a_star_search(dijkstra_ctx_t *ctx, graph_t const *graph,
+	vertex_t const *start, vertex_t const *target)
 {
-	vertex_t *current, *neighbor;
-	edge_t *edge;
-	size_t i = 0, tentative_g_score;
-
-	current = get_min_g_score(graph, f_score, visited, &idx);
-	if (!current)
-		return;
+	size_t j;
 
-	f_score[current->index] = h(current->x, current->y, target->x, target->y);
-	printf("Checking %s, distance to %s is %ld\n", current->content,
-			target->content, f_score[current->index]);
-	i = current->index;
-	edge = current->edges;
-	while (edge && visited[i] == 0)
+	if (!dijkstra_ctx_prepare(ctx, graph))
+		return (-1);
+	ctx->stamps[start->index] = ctx->generation;
+	ctx->dists[start->index] = 0, ctx->from[start->index] = NULL;
+	min_heap_push(&ctx->heap, start->index,
+		a_star_estimate(ctx, start, target));
+	while (ctx->heap.size)
 	{
-		neighbor = edge->dest;
-		tentative_g_score = g_score[i] + edge->weight;
-		if (g_score[neighbor->index] > tentative_g_score)
-		{
-			came_from[neighbor->index] = current;
-			g_score[neighbor->index] = tentative_g_score;
-			f_score[neighbor->index] = g_score[neighbor->index] +
-				h(neighbor->x, neighbor->y, target->x, target->y);
-		}
-		edge = edge->next;
+		j = min_heap_pop(&ctx->heap), ctx->nb_expanded++;
+		if (ctx->trace)
+			printf("Checking %s, distance to %s is %lu\n",
+				ctx->verts[j]->content, target->content,
+				a_star_estimate(ctx, ctx->verts[j], target));
+		if (j == target->index)
+			return (1);
+		a_star_relax(ctx, j, target);
 	}
-	visited[i] = 1;
-	if (visited[target->index] == 1)
-		return;
-
-	recursive_a_star(graph, visited, came_from, start, target,
-		f_score, g_score, idx);
+	return (0);
 }
 
-
 /**
- * initialize_a_star - initializes all the arrays for A* search
+ * a_star_graph_r - reentrant version of a_star_graph
+ * The heuristic is the one selected in @ctx (see heuristic_get), and
+ * @ctx->nb_expanded tells how many vertices the search expanded
  *
- * @graph: graph that we are examining
- * @visited: has this vertex been visited?
- * @came_from: array of parents of visited nodes
- * @f_score: array of g_score + h(current, target)
- * @g_score: distance from start to current
- * @start: starting vertex
- * @target: target vertex
+ * @ctx: query context of the calling thread
+ * @graph: pointer to graph to go through
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
  *
- * Return: 1 on success, -1 on failure
+ * Return: queue in which each node is a char * corresponding to a vertex
+ *	forming a path from start to target
  */
-int initialize_a_star(graph_t *graph, size_t **visited, vertex_t ***came_from,
-	size_t **f_score, size_t **g_score,
-	const vertex_t *start, const vertex_t *target)
+queue_t *a_star_graph_r(dijkstra_ctx_t *ctx, graph_t const *graph,
+	vertex_t const *start, vertex_t const *target)
 {
-	size_t i;
-
-	*visited = calloc(graph->nb_vertices, sizeof(**visited));
-	if (!*visited)
-		return (-1);
-	*came_from = calloc(graph->nb_vertices, sizeof(***came_from));
-	if (!*came_from)
-	{
-		free(*visited);
-		return (-1);
-	}
-	*f_score = malloc(graph->nb_vertices * sizeof(**f_score));
-	if (!*f_score)
-	{
-		free(*visited), free(*came_from);
-		return (-1);
-	}
-	*g_score = malloc(graph->nb_vertices * sizeof(**g_score));
-	if (!*g_score)
-	{
-		free(*visited), free(*came_from), free(*f_score);
-		return (-1);
-	}
-	for (i = 0; i < graph->nb_vertices; i++)
-	{
-		(*f_score)[i] = ULONG_MAX;
-		(*g_score)[i] = ULONG_MAX;
-	}
-	(*g_score)[start->index] = 0;
-	(*f_score)[start->index] = h(start->x, start->y,
-							target->x, target->y);
-	return (1);
+	if (!ctx || !graph || !start || !target)
+		return (NULL);
+	if (a_star_search(ctx, graph, start, target) != 1)
+		return (NULL);
+	return (dijkstra_path(ctx, target));
 }
 
 /**
@@ -197,29 +123,20 @@ int initialize_a_star(graph_t *graph, size_t **visited, vertex_t ***came_from,
 queue_t *a_star_graph(graph_t *graph, vertex_t const *start,
 					vertex_t const *target)
 {
-	size_t *f_score, *g_score, *visited = 0;
-	queue_t *queue = NULL;
-	vertex_t **came_from = NULL;
-
-	if (!graph || !start || !target)
-		return (NULL);
+	dijkstra_ctx_t *ctx = dijkstra_ctx_create();
+	queue_t *path;
 
-	if (!initialize_a_star(graph, &visited, &came_from, &f_score, &g_score,
-			start, target))
+	if (!ctx)
 		return (NULL);
-
-	queue = queue_create();
-
-	recursive_a_star(graph, visited, came_from, start, target,
-		f_score, g_score, 0);
-	reconstruct_path(graph, queue, came_from, start, target);
-
-	free(visited), free(f_score), free(g_score), free(came_from);
-
-	if (!queue->front)
+	ctx->trace = 1;
+	path = a_star_graph_r(ctx, graph, start, target);
+	dijkstra_ctx_delete(ctx);
+	/* A path from a vertex to itself has always been reported as none */
+	if (path && start == target)
 	{
-		free(queue);
-		return (NULL);
+		free(dequeue(path));
+		free(path);
+		path = NULL;
 	}
-	return (queue);
+	return (path);
 }
@@ -1,11 +1,45 @@
 #include "pathfinding.h"
-#include <sys/types.h>
 
-static int *dists;
-static vertex_t **from;
-static vertex_t **verts;
+/**
+ * dijkstra_path - builds the path found by the last query of a context
+ * @ctx: pointer to the query context
+ * @target: pointer to the settled target vertex
+ * Return: queue of the names of the vertices from start to @target,
+ *   NULL on failure
+ */
+queue_t *dijkstra_path(dijkstra_ctx_t const *ctx, vertex_t const *target)
+{
+	queue_t *path = queue_create();
 
-#define STRDUP(x) ((str = strdup(x)) ? str : (exit(1), NULL))
+	if (!path)
+		return (NULL);
+	for (; ctx->from[target->index]; target = ctx->from[target->index])
+		if (!path_queue_push(path, target->content, 1))
+			return (NULL);
+	if (!path_queue_push(path, target->content, 1))
+		return (NULL);
+	return (path);
+}
+
+/**
+ * dijkstra_graph_r - reentrant version of dijkstra_graph
+ * All the scratch space lives in @ctx, so several threads can search
+ * the same graph at once with one context each
+ * @ctx: pointer to the query context of the calling thread
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+queue_t *dijkstra_graph_r(dijkstra_ctx_t *ctx, graph_t const *graph,
+	vertex_t const *start, vertex_t const *target)
+{
+	if (!ctx || !graph || !start || !target)
+		return (NULL);
+	if (dijkstra_search(ctx, graph, start, target) != 1)
+		return (NULL);
+	return (dijkstra_path(ctx, target));
+}
 
 /**
  * dijkstra_graph - uses Dijkstra's Algo to find path
@@ -17,44 +51,13 @@ static vertex_t **verts;
 queue_t *dijkstra_graph(graph_t *graph, vertex_t const *start,
 	vertex_t const *target)
 {
-	ssize_t i, d, j = -1;
-	vertex_t *v;
-	edge_t *e;
-	queue_t *path = queue_create();
-	char *str;
+	dijkstra_ctx_t *ctx = dijkstra_ctx_create();
+	queue_t *path;
 
-	if (!graph || !start || !target || !path)
-		return (NULL);
-	dists = calloc(graph->nb_vertices, sizeof(*dists));
-	from = calloc(graph->nb_vertices, sizeof(*from));
-	verts = calloc(graph->nb_vertices, sizeof(*verts));
-	if (!dists || !from || !verts || !path)
+	if (!ctx)
 		return (NULL);
-	for (v = graph->vertices; v; v = v->next)
-		verts[v->index] = v, dists[v->index] = INT_MAX;
-	dists[start->index] = 0, from[start->index] = NULL;
-	while (j != (ssize_t)target->index)
-	{
-		for (d = INT_MAX, j = -1, i = 0; i < (ssize_t)graph->nb_vertices; i++)
-			if (dists[i] >= 0 && dists[i] < d)
-				d = dists[i], j = i;
-		if (j == -1)
-			break;
-		printf("Checking %s, distance from %s is %d\n",
-			verts[j]->content, start->content, dists[j]);
-		for (e = verts[j]->edges; e; e = e->next)
-			if (dists[e->dest->index] >= 0 &&
-				dists[j] + e->weight < dists[e->dest->index])
-				dists[e->dest->index] = dists[j] + e->weight,
-					from[e->dest->index] = verts[j];
-		dists[j] = -1;
-	}
-	if (j != -1)
-		for (queue_push_front(path, STRDUP(verts[j]->content));
-			j != (ssize_t)start->index; j = from[j]->index)
-			queue_push_front(path, STRDUP(from[j]->content));
-	else
-		path = (free(path), NULL);
-	free(dists), free(from), free(verts);
+	ctx->trace = 1;
+	path = dijkstra_graph_r(ctx, graph, start, target);
+	dijkstra_ctx_delete(ctx);
 	return (path);
 }
@@ -0,0 +1,63 @@
+#include "pathfinding.h"
+
+/**
+ * arena_alloc - hands out memory from an arena
+ * Requests are carved from the current block, and a new block of
+ * ARENA_BLOCK_SIZE bytes (or more for a large request) is started once it
+ * is full. Memory is aligned on ARENA_ALIGN bytes and never freed alone
+ * @arena: pointer to the arena
+ * @size: number of bytes
+ * Return: pointer to the memory, NULL on failure
+ */
+void *arena_alloc(arena_t *arena, size_t size)
+{
+	arena_block_t *block = arena->blocks;
+	char *mem;
+
+	size = ARENA_ROUND(size ? size : 1);
+	if (!block || block->size - block->used < size)
+	{
+		block = malloc(ARENA_HEADER + (size > ARENA_BLOCK_SIZE ?
+			size : ARENA_BLOCK_SIZE));
+		if (!block)
+			return (NULL);
+		block->size = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+		block->used = 0, block->next = arena->blocks;
+		arena->blocks = block;
+	}
+	mem = (char *)block + ARENA_HEADER + block->used;
+	block->used += size;
+	return (mem);
+}
+
+/**
+ * arena_strdup - duplicates a string into an arena
+ * @arena: pointer to the arena
+ * @str: string to duplicate
+ * Return: pointer to the copy, NULL on failure
+ */
+char *arena_strdup(arena_t *arena, char const *str)
+{
+	size_t len = strlen(str) + 1;
+	char *copy = arena_alloc(arena, len);
+
+	if (copy)
+		memcpy(copy, str, len);
+	return (copy);
+}
+
+/**
+ * arena_free - frees every block of an arena, leaving it empty
+ * @arena: pointer to the arena
+ */
+void arena_free(arena_t *arena)
+{
+	arena_block_t *block, *next;
+
+	for (block = arena->blocks; block; block = next)
+	{
+		next = block->next;
+		free(block);
+	}
+	arena->blocks = NULL;
+}
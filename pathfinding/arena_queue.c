@@ -0,0 +1,86 @@
+#include "pathfinding.h"
+
+/**
+ * arena_queue_create - allocates an empty queue backed by an arena
+ * Return: pointer to the queue, NULL on failure
+ */
+arena_queue_t *arena_queue_create(void)
+{
+	return (calloc(1, sizeof(arena_queue_t)));
+}
+
+/**
+ * arena_queue_push_back - pushes an element at the back of an arena queue
+ * @aq: pointer to the queue
+ * @ptr: data to store in the new node
+ * Return: pointer to the created node, NULL on failure
+ */
+queue_node_t *arena_queue_push_back(arena_queue_t *aq, void *ptr)
+{
+	queue_node_t *node = arena_alloc(&aq->arena, sizeof(*node));
+
+	if (!node)
+		return (NULL);
+	node->ptr = ptr, node->next = NULL, node->prev = aq->queue.back;
+	if (aq->queue.back)
+		aq->queue.back->next = node;
+	else
+		aq->queue.front = node;
+	aq->queue.back = node;
+	return (node);
+}
+
+/**
+ * arena_queue_push_front - pushes an element at the front of an arena
+ * queue
+ * @aq: pointer to the queue
+ * @ptr: data to store in the new node
+ * Return: pointer to the created node, NULL on failure
+ */
+queue_node_t *arena_queue_push_front(arena_queue_t *aq, void *ptr)
+{
+	queue_node_t *node = arena_alloc(&aq->arena, sizeof(*node));
+
+	if (!node)
+		return (NULL);
+	node->ptr = ptr, node->prev = NULL, node->next = aq->queue.front;
+	if (aq->queue.front)
+		aq->queue.front->prev = node;
+	else
+		aq->queue.back = node;
+	aq->queue.front = node;
+	return (node);
+}
+
+/**
+ * arena_queue_pop - pops out the front node of an arena queue
+ * The node stays in the arena until the queue is deleted
+ * @aq: pointer to the queue
+ * Return: the data of the popped node, NULL if the queue is empty
+ */
+void *arena_queue_pop(arena_queue_t *aq)
+{
+	queue_node_t *node = aq->queue.front;
+
+	if (!node)
+		return (NULL);
+	aq->queue.front = node->next;
+	if (aq->queue.front)
+		aq->queue.front->prev = NULL;
+	else
+		aq->queue.back = NULL;
+	return (node->ptr);
+}
+
+/**
+ * arena_queue_delete - deallocates an arena queue along with every node
+ * and every piece of data allocated in its arena
+ * @aq: pointer to the queue
+ */
+void arena_queue_delete(arena_queue_t *aq)
+{
+	if (!aq)
+		return;
+	arena_free(&aq->arena);
+	free(aq);
+}
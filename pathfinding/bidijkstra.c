@@ -0,0 +1,133 @@
+#include "pathfinding.h"
+
+/**
+ * bidijkstra_step - settles one vertex of one side of a bidirectional
+ * Dijkstra query and relaxes its edges
+ * @ctx: pointer to the context of the side
+ * @other: pointer to the context of the other side
+ * @csr: snapshot searched by the side, transposed for the backward side
+ * @meet: pointer to the best meeting vertex found so far, updated when a
+ *   relaxed vertex joins both sides through a shorter path
+ */
+void bidijkstra_step(dijkstra_ctx_t *ctx, dijkstra_ctx_t const *other,
+	csr_graph_t const *csr, size_t *meet)
+{
+	size_t j, e, k;
+	int d;
+
+	j = min_heap_pop(&ctx->heap), ctx->nb_expanded++;
+	d = ctx->dists[j];
+	for (e = csr->offsets[j]; e < csr->offsets[j + 1]; e++)
+	{
+		k = csr->dests[e];
+		if (!dijkstra_settled(ctx, k) &&
+			d + csr->weights[e] < dijkstra_dist(ctx, k))
+			dijkstra_reach(ctx, k, d + csr->weights[e],
+				csr->vertices[j]);
+		if (dijkstra_dist(other, k) != INT_MAX &&
+			dijkstra_dist(ctx, k) + dijkstra_dist(other, k) <
+			bidir_best(ctx, other, *meet))
+			*meet = k;
+	}
+}
+
+/**
+ * bidijkstra_search - searches forward from the start vertex and backward
+ * from the target vertex until the two searches meet
+ * The searches stop once the sum of their lowest unsettled distances
+ * reaches the best path found, which is then a shortest path
+ * @fwd: pointer to the context of the forward search
+ * @bwd: pointer to the context of the backward search
+ * @csr: snapshot of the graph
+ * @rev: transposed snapshot of the graph
+ * @start: index of the starting vertex
+ * @target: index of the target vertex
+ * Return: index of the meeting vertex of a shortest path, or
+ *   @csr->nb_vertices if there is none or on failure
+ */
+size_t bidijkstra_search(dijkstra_ctx_t *fwd, dijkstra_ctx_t *bwd,
+	csr_graph_t const *csr, csr_graph_t const *rev, size_t start,
+	size_t target)
+{
+	size_t meet = csr->nb_vertices;
+	long f, b;
+
+	if (!dijkstra_ctx_begin(fwd, csr->nb_vertices) ||
+		!dijkstra_ctx_begin(bwd, csr->nb_vertices))
+		return (csr->nb_vertices);
+	dijkstra_reach(fwd, start, 0, NULL);
+	dijkstra_reach(bwd, target, 0, NULL);
+	if (start == target)
+		meet = start;
+	while (fwd->heap.size && bwd->heap.size)
+	{
+		f = bidir_top(fwd), b = bidir_top(bwd);
+		if (f + b >= bidir_best(fwd, bwd, meet))
+			break;
+		if (f <= b)
+			bidijkstra_step(fwd, bwd, csr, &meet);
+		else
+			bidijkstra_step(bwd, fwd, rev, &meet);
+	}
+	return (meet);
+}
+
+/**
+ * bidijkstra_graph_r - finds a shortest path with a bidirectional
+ * Dijkstra search on prebuilt snapshots
+ * All the scratch space lives in @fwd and @bwd, so several threads can
+ * search the same snapshots at once with two contexts each
+ * @fwd: pointer to the context of the forward search
+ * @bwd: pointer to the context of the backward search
+ * @csr: snapshot of the graph
+ * @rev: transposed snapshot of the graph
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+queue_t *bidijkstra_graph_r(dijkstra_ctx_t *fwd, dijkstra_ctx_t *bwd,
+	csr_graph_t const *csr, csr_graph_t const *rev,
+	vertex_t const *start, vertex_t const *target)
+{
+	queue_t *path;
+	size_t j;
+
+	if (!fwd || !bwd || !csr || !rev || !start || !target)
+		return (NULL);
+	j = bidijkstra_search(fwd, bwd, csr, rev, start->index, target->index);
+	if (j == csr->nb_vertices)
+		return (NULL);
+	path = dijkstra_path(fwd, csr->vertices[j]);
+	for (; path && bwd->from[j]; j = bwd->from[j]->index)
+		if (!path_queue_push(path, bwd->from[j]->content, 0))
+			return (NULL);
+	return (path);
+}
+
+/**
+ * bidijkstra_graph - finds a shortest path with a bidirectional Dijkstra
+ * search, returning the same path queue as dijkstra_graph
+ * The graph is snapshotted and transposed on every call; callers running
+ * many queries on the same graph should keep the snapshots and use
+ * bidijkstra_graph_r
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+queue_t *bidijkstra_graph(graph_t *graph, vertex_t const *start,
+	vertex_t const *target)
+{
+	csr_graph_t *csr = graph_freeze(graph), *rev = NULL;
+	dijkstra_ctx_t *fwd = dijkstra_ctx_create();
+	dijkstra_ctx_t *bwd = dijkstra_ctx_create();
+	queue_t *path = NULL;
+
+	if (csr)
+		rev = csr_transpose(csr);
+	if (rev && fwd && bwd)
+		path = bidijkstra_graph_r(fwd, bwd, csr, rev, start, target);
+	csr_graph_delete(csr), csr_graph_delete(rev);
+	dijkstra_ctx_delete(fwd), dijkstra_ctx_delete(bwd);
+	return (path);
+}
@@ -0,0 +1,31 @@
+#include "pathfinding.h"
+
+/**
+ * bidir_top - gets the lowest distance not settled yet by one side of a
+ * bidirectional search
+ * @ctx: pointer to the query context of the side
+ * Return: the distance, INT_MAX if the side has nothing left to settle
+ */
+int bidir_top(dijkstra_ctx_t const *ctx)
+{
+	if (!ctx->heap.size)
+		return (INT_MAX);
+	return (ctx->dists[ctx->heap.items[0]]);
+}
+
+/**
+ * bidir_best - gets the length of the path through the meeting vertex of
+ * a bidirectional search
+ * @fwd: pointer to the context of one side of the search
+ * @bwd: pointer to the context of the other side
+ * @meet: index of the meeting vertex, or the number of vertices if the
+ *   searches have not met yet
+ * Return: the length, INT_MAX if the searches have not met yet
+ */
+int bidir_best(dijkstra_ctx_t const *fwd, dijkstra_ctx_t const *bwd,
+	size_t meet)
+{
+	if (meet >= fwd->capacity || dijkstra_dist(fwd, meet) == INT_MAX)
+		return (INT_MAX);
+	return (dijkstra_dist(fwd, meet) + dijkstra_dist(bwd, meet));
+}
@@ -0,0 +1,113 @@
+#include "pathfinding.h"
+
+/**
+ * ch_list_add - adds an edge to an edge list, or lowers the weight of
+ * the edge already leading to the same vertex
+ * @list: pointer to the list
+ * @dest: index of the vertex at the other end of the edge
+ * @weight: weight of the edge
+ * @middle: vertex the edge bypasses, CH_NO_MIDDLE for an original edge
+ * Return: 1 on success, 0 on failure
+ */
+int ch_list_add(ch_list_t *list, size_t dest, int weight, size_t middle)
+{
+	ch_edge_t *edges;
+	size_t i;
+
+	for (i = 0; i < list->size; i++)
+	{
+		if (list->edges[i].dest != dest)
+			continue;
+		if (weight < list->edges[i].weight)
+			list->edges[i].weight = weight,
+			list->edges[i].middle = middle;
+		return (1);
+	}
+	if (list->size == list->capacity)
+	{
+		edges = realloc(list->edges, (list->capacity * 2 + 4) *
+			sizeof(*edges));
+		if (!edges)
+			return (0);
+		list->edges = edges, list->capacity = list->capacity * 2 + 4;
+	}
+	list->edges[list->size].dest = dest;
+	list->edges[list->size].weight = weight;
+	list->edges[list->size++].middle = middle;
+	return (1);
+}
+
+/**
+ * ch_list_remove - removes the edge leading to a vertex from an edge list
+ * The last edge takes its place, so the order of the list is not kept
+ * @list: pointer to the list
+ * @dest: index of the vertex at the other end of the edge
+ */
+void ch_list_remove(ch_list_t *list, size_t dest)
+{
+	size_t i;
+
+	for (i = 0; i < list->size; i++)
+	{
+		if (list->edges[i].dest == dest)
+		{
+			list->edges[i] = list->edges[--list->size];
+			return;
+		}
+	}
+}
+
+/**
+ * ch_build_create - sets up the contraction of a graph
+ * Self loops never lie on a shortest path and are left out, and only the
+ * lightest of parallel edges is kept
+ * @csr: snapshot of the graph
+ * Return: pointer to the contraction state, NULL on failure
+ */
+ch_build_t *ch_build_create(csr_graph_t const *csr)
+{
+	ch_build_t *b = calloc(1, sizeof(*b));
+	size_t i, e, n = csr->nb_vertices;
+	int ok;
+
+	if (!b)
+		return (NULL);
+	b->nb_vertices = n;
+	b->out = calloc(n + 1, sizeof(*b->out));
+	b->in = calloc(n + 1, sizeof(*b->in));
+	b->rank = calloc(n + 1, sizeof(*b->rank));
+	b->deleted = calloc(n + 1, sizeof(*b->deleted));
+	b->ctx = dijkstra_ctx_create();
+	ok = b->out && b->in && b->rank && b->deleted && b->ctx &&
+		dijkstra_ctx_reserve(b->ctx, n + 1) &&
+		min_heap_init(&b->order, n + 1);
+	for (i = 0; ok && i < n; i++)
+		for (e = csr->offsets[i]; ok && e < csr->offsets[i + 1]; e++)
+			if (csr->dests[e] != i)
+				ok = ch_list_add(&b->out[i], csr->dests[e],
+					csr->weights[e], CH_NO_MIDDLE) &&
+					ch_list_add(&b->in[csr->dests[e]], i,
+					csr->weights[e], CH_NO_MIDDLE);
+	if (!ok)
+		ch_build_delete(b), b = NULL;
+	return (b);
+}
+
+/**
+ * ch_build_delete - deallocates the state of a contraction
+ * @b: pointer to the contraction state
+ */
+void ch_build_delete(ch_build_t *b)
+{
+	size_t i;
+
+	if (!b)
+		return;
+	for (i = 0; b->out && i < b->nb_vertices; i++)
+		free(b->out[i].edges);
+	for (i = 0; b->in && i < b->nb_vertices; i++)
+		free(b->in[i].edges);
+	free(b->out), free(b->in), free(b->rank), free(b->deleted);
+	min_heap_free(&b->order), dijkstra_ctx_delete(b->ctx);
+	free(b);
+}
@@ -0,0 +1,56 @@
+#include "pathfinding.h"
+
+/**
+ * ch_check_edges - checks the edges stored with a vertex of a loaded
+ * hierarchy: each one leads to a higher ranked vertex, and each shortcut
+ * bypasses a vertex ranked lower than both ends, so unpacking ends
+ * @ch: pointer to the hierarchy, whose ranks are already checked
+ * @edges: edges of the vertex
+ * @nb_edges: number of edges
+ * @v: index of the vertex
+ * Return: 1 if the edges are valid, 0 otherwise
+ */
+int ch_check_edges(ch_graph_t const *ch, ch_edge_t const *edges,
+	size_t nb_edges, size_t v)
+{
+	size_t e, n = ch->nb_vertices;
+
+	for (e = 0; e < nb_edges; e++)
+	{
+		if (edges[e].dest >= n ||
+			ch->rank[edges[e].dest] <= ch->rank[v])
+			return (0);
+		if (edges[e].middle != CH_NO_MIDDLE &&
+			(edges[e].middle >= n ||
+			ch->rank[edges[e].middle] >= ch->rank[v]))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * ch_check - checks that a loaded hierarchy can be searched safely:
+ * ranks are a permutation of the vertices, offsets never decrease and end
+ * on the number of edges, and every edge is valid (see ch_check_edges)
+ * @ch: pointer to the hierarchy
+ * Return: 1 if the hierarchy is valid, 0 otherwise or on failure
+ */
+int ch_check(ch_graph_t const *ch)
+{
+	size_t n = ch->nb_vertices, v;
+	size_t const *up = ch->up_offsets, *down = ch->down_offsets;
+	char *seen = calloc(n + 1, 1);
+	int ok = seen && !up[0] && !down[0] &&
+		up[n] == ch->nb_up && down[n] == ch->nb_down;
+
+	for (v = 0; ok && v < n; v++)
+		ok = ch->rank[v] < n && !seen[ch->rank[v]]++;
+	for (v = 0; ok && v < n; v++)
+		ok = up[v] <= up[v + 1] && down[v] <= down[v + 1];
+	for (v = 0; ok && v < n; v++)
+		ok = ch_check_edges(ch, ch->up + up[v], up[v + 1] - up[v], v) &&
+			ch_check_edges(ch, ch->down + down[v],
+				down[v + 1] - down[v], v);
+	free(seen);
+	return (ok);
+}
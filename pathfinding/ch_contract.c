@@ -0,0 +1,134 @@
+#include "pathfinding.h"
+
+/**
+ * ch_witness - searches for paths from a vertex that avoid the vertex
+ * being contracted
+ * The search stops past @max or after CH_WITNESS_LIMIT settled vertices;
+ * stopping early only costs superfluous shortcuts
+ * @b: pointer to the contraction state
+ * @u: index of the vertex to search from
+ * @v: index of the vertex being contracted
+ * @max: longest distance worth searching
+ */
+void ch_witness(ch_build_t *b, size_t u, size_t v, int max)
+{
+	dijkstra_ctx_t *ctx = b->ctx;
+	ch_edge_t const *e;
+	size_t j, i;
+	int d;
+
+	if (!dijkstra_ctx_begin(ctx, b->nb_vertices))
+		return;
+	dijkstra_reach(ctx, u, 0, NULL);
+	while (ctx->heap.size && ctx->nb_expanded < CH_WITNESS_LIMIT)
+	{
+		j = min_heap_pop(&ctx->heap), ctx->nb_expanded++;
+		d = ctx->dists[j];
+		if (d > max)
+			break;
+		for (i = 0; i < b->out[j].size; i++)
+		{
+			e = &b->out[j].edges[i];
+			if (e->dest != v && !dijkstra_settled(ctx, e->dest) &&
+				d + e->weight < dijkstra_dist(ctx, e->dest))
+				dijkstra_reach(ctx, e->dest, d + e->weight,
+					NULL);
+		}
+	}
+}
+
+/**
+ * ch_shortcuts - finds the shortcuts the contraction of a vertex needs
+ * A shortcut u -> x replaces u -> v -> x unless a witness path from u to
+ * x avoiding v is at most as long
+ * @b: pointer to the contraction state
+ * @v: index of the vertex to contract
+ * @apply: whether to add the shortcuts to the edge lists
+ * Return: number of shortcuts, -1 on failure
+ */
+int ch_shortcuts(ch_build_t *b, size_t v, int apply)
+{
+	ch_edge_t const *in, *out;
+	size_t i, k;
+	int max, count = 0;
+
+	for (i = 0; i < b->in[v].size; i++)
+	{
+		in = &b->in[v].edges[i];
+		for (k = 0, max = -1; k < b->out[v].size; k++)
+			if (b->out[v].edges[k].dest != in->dest &&
+				in->weight + b->out[v].edges[k].weight > max)
+				max = in->weight + b->out[v].edges[k].weight;
+		if (max < 0)
+			continue;
+		ch_witness(b, in->dest, v, max);
+		for (k = 0; k < b->out[v].size; k++)
+		{
+			out = &b->out[v].edges[k];
+			if (out->dest == in->dest ||
+				dijkstra_dist(b->ctx, out->dest) <=
+				in->weight + out->weight)
+				continue;
+			count++;
+			if (apply && (!ch_list_add(&b->out[in->dest], out->dest,
+				in->weight + out->weight, v) ||
+				!ch_list_add(&b->in[out->dest], in->dest,
+				in->weight + out->weight, v)))
+				return (-1);
+		}
+	}
+	return (count);
+}
+
+/**
+ * ch_priority - computes the contraction priority of a vertex
+ * Vertices adding few shortcuts for the edges they remove, and with few
+ * contracted neighbors, are contracted first
+ * @b: pointer to the contraction state
+ * @v: index of the vertex
+ * Return: priority, lowest first, as a heap key
+ */
+size_t ch_priority(ch_build_t *b, size_t v)
+{
+	size_t shortcuts = ch_shortcuts(b, v, 0);
+
+	return (CH_PRIORITY_BIAS + shortcuts + b->deleted[v] -
+		b->in[v].size - b->out[v].size);
+}
+
+/**
+ * ch_contract - contracts a vertex, adding its shortcuts and removing it
+ * from the lists of its neighbors, whose priorities are then updated
+ * @b: pointer to the contraction state
+ * @v: index of the vertex, which must not be in @b->order
+ * Return: 1 on success, 0 on failure
+ */
+int ch_contract(ch_build_t *b, size_t v)
+{
+	size_t i, n;
+
+	if (ch_shortcuts(b, v, 1) < 0)
+		return (0);
+	b->rank[v] = b->nb_ranked++;
+	for (i = 0; i < b->in[v].size; i++)
+	{
+		n = b->in[v].edges[i].dest;
+		ch_list_remove(&b->out[n], v), b->deleted[n]++;
+	}
+	for (i = 0; i < b->out[v].size; i++)
+	{
+		n = b->out[v].edges[i].dest;
+		ch_list_remove(&b->in[n], v), b->deleted[n]++;
+	}
+	for (i = 0; i < b->in[v].size; i++)
+	{
+		n = b->in[v].edges[i].dest;
+		min_heap_push(&b->order, n, ch_priority(b, n));
+	}
+	for (i = 0; i < b->out[v].size; i++)
+	{
+		n = b->out[v].edges[i].dest;
+		min_heap_push(&b->order, n, ch_priority(b, n));
+	}
+	return (1);
+}
@@ -0,0 +1,117 @@
+#include "pathfinding.h"
+
+/**
+ * ch_alloc - allocates an empty contraction hierarchy
+ * @nb_vertices: number of vertices
+ * @nb_up: number of upward edges
+ * @nb_down: number of downward edges
+ * Return: pointer to the hierarchy, NULL on failure or if the arrays
+ *   would not fit in memory
+ */
+ch_graph_t *ch_alloc(size_t nb_vertices, size_t nb_up, size_t nb_down)
+{
+	ch_graph_t *ch;
+
+	if (nb_vertices >= (size_t)-1 / sizeof(size_t) ||
+		nb_up >= (size_t)-1 / sizeof(ch_edge_t) ||
+		nb_down >= (size_t)-1 / sizeof(ch_edge_t))
+		return (NULL);
+	ch = calloc(1, sizeof(*ch));
+	if (!ch)
+		return (NULL);
+	ch->nb_vertices = nb_vertices, ch->nb_up = nb_up, ch->nb_down = nb_down;
+	ch->rank = malloc((nb_vertices + 1) * sizeof(*ch->rank));
+	ch->up_offsets = malloc((nb_vertices + 1) * sizeof(*ch->up_offsets));
+	ch->up = malloc((nb_up + 1) * sizeof(*ch->up));
+	ch->down_offsets = malloc((nb_vertices + 1) *
+		sizeof(*ch->down_offsets));
+	ch->down = malloc((nb_down + 1) * sizeof(*ch->down));
+	ch->vertices = calloc(nb_vertices + 1, sizeof(*ch->vertices));
+	if (!ch->rank || !ch->up_offsets || !ch->up || !ch->down_offsets ||
+		!ch->down || !ch->vertices)
+	{
+		ch_delete(ch);
+		return (NULL);
+	}
+	return (ch);
+}
+
+/**
+ * ch_delete - deallocates a contraction hierarchy
+ * @ch: pointer to the hierarchy
+ */
+void ch_delete(ch_graph_t *ch)
+{
+	if (!ch)
+		return;
+	free(ch->rank), free(ch->up_offsets), free(ch->up);
+	free(ch->down_offsets), free(ch->down), free(ch->vertices);
+	free(ch);
+}
+
+/**
+ * ch_finalize - packs the edges of a fully contracted graph towards
+ * higher ranked vertices into a contraction hierarchy
+ * @b: pointer to the contraction state, every vertex being contracted
+ * @csr: snapshot of the graph
+ * Return: pointer to the hierarchy, NULL on failure
+ */
+ch_graph_t *ch_finalize(ch_build_t const *b, csr_graph_t const *csr)
+{
+	ch_graph_t *ch;
+	size_t v, i, nb_up = 0, nb_down = 0;
+
+	for (v = 0; v < b->nb_vertices; v++)
+		nb_up += b->out[v].size, nb_down += b->in[v].size;
+	ch = ch_alloc(b->nb_vertices, nb_up, nb_down);
+	if (!ch)
+		return (NULL);
+	memcpy(ch->rank, b->rank, b->nb_vertices * sizeof(*ch->rank));
+	memcpy(ch->vertices, csr->vertices,
+		b->nb_vertices * sizeof(*ch->vertices));
+	for (v = 0, nb_up = 0, nb_down = 0; v < b->nb_vertices; v++)
+	{
+		ch->up_offsets[v] = nb_up, ch->down_offsets[v] = nb_down;
+		for (i = 0; i < b->out[v].size; i++)
+			if (b->rank[b->out[v].edges[i].dest] > b->rank[v])
+				ch->up[nb_up++] = b->out[v].edges[i];
+		for (i = 0; i < b->in[v].size; i++)
+			if (b->rank[b->in[v].edges[i].dest] > b->rank[v])
+				ch->down[nb_down++] = b->in[v].edges[i];
+	}
+	ch->up_offsets[v] = nb_up, ch->down_offsets[v] = nb_down;
+	ch->nb_up = nb_up, ch->nb_down = nb_down;
+	return (ch);
+}
+
+/**
+ * ch_create - builds the contraction hierarchy of a graph
+ * Vertices are contracted by increasing edge difference plus number of
+ * contracted neighbors. Priorities are updated lazily: a popped vertex
+ * whose recomputed priority is no longer the lowest goes back in the heap
+ * @graph: pointer to the graph, which must not change afterwards
+ * Return: pointer to the hierarchy, NULL on failure
+ */
+ch_graph_t *ch_create(graph_t const *graph)
+{
+	csr_graph_t *csr = graph_freeze(graph);
+	ch_build_t *b = csr ? ch_build_create(csr) : NULL;
+	ch_graph_t *ch = NULL;
+	size_t v, key;
+
+	for (v = 0; b && v < b->nb_vertices; v++)
+		min_heap_push(&b->order, v, ch_priority(b, v));
+	while (b && b->order.size)
+	{
+		v = min_heap_pop(&b->order);
+		key = ch_priority(b, v);
+		if (b->order.size && key > b->order.keys[b->order.items[0]])
+			min_heap_push(&b->order, v, key);
+		else if (!ch_contract(b, v))
+			break;
+	}
+	if (b && b->nb_ranked == b->nb_vertices)
+		ch = ch_finalize(b, csr);
+	ch_build_delete(b), csr_graph_delete(csr);
+	return (ch);
+}
@@ -0,0 +1,103 @@
+#include "pathfinding.h"
+
+/**
+ * ch_unpack - appends the vertices of a hierarchy edge to a path,
+ * replacing each shortcut by the two edges it bypasses
+ * @ch: pointer to the hierarchy
+ * @a: index of the source of the edge, already in @path
+ * @b: index of the destination of the edge
+ * @path: queue of vertex names to append to
+ * Return: 1 on success, 0 on failure, @path being freed then
+ */
+int ch_unpack(ch_graph_t const *ch, size_t a, size_t b, queue_t *path)
+{
+	ch_edge_t const *e = ch_find_edge(ch, a, b);
+
+	if (e && e->middle != CH_NO_MIDDLE)
+		return (ch_unpack(ch, a, e->middle, path) &&
+			ch_unpack(ch, e->middle, b, path));
+	return (path_queue_push(path, ch->vertices[b]->content, 0));
+}
+
+/**
+ * ch_path - builds the path found by the last contraction hierarchy query
+ * @fwd: pointer to the context of the forward search
+ * @bwd: pointer to the context of the backward search
+ * @ch: pointer to the hierarchy
+ * @meet: index of the meeting vertex returned by ch_search
+ * Return: queue of the names of the vertices from start to target,
+ *   NULL on failure
+ */
+queue_t *ch_path(dijkstra_ctx_t const *fwd, dijkstra_ctx_t const *bwd,
+	ch_graph_t const *ch, size_t meet)
+{
+	queue_t *path = queue_create();
+	size_t *hops, nb_hops = 0, i, j;
+	int ok;
+
+	for (j = meet; fwd->from[j]; j = fwd->from[j]->index)
+		nb_hops++;
+	hops = malloc((nb_hops + 1) * sizeof(*hops));
+	if (!path || !hops)
+	{
+		free(hops);
+		if (path)
+			queue_delete(path);
+		return (NULL);
+	}
+	for (j = meet, i = nb_hops; i; j = fwd->from[j]->index)
+		hops[i--] = j;
+	hops[0] = j;
+	ok = path_queue_push(path, ch->vertices[j]->content, 0);
+	for (i = 0; ok && i < nb_hops; i++)
+		ok = ch_unpack(ch, hops[i], hops[i + 1], path);
+	for (j = meet; ok && bwd->from[j]; j = bwd->from[j]->index)
+		ok = ch_unpack(ch, j, bwd->from[j]->index, path);
+	free(hops);
+	return (ok ? path : NULL);
+}
+
+/**
+ * ch_graph_r - finds a shortest path with a contraction hierarchy
+ * All the scratch space lives in @fwd and @bwd, so several threads can
+ * query the same hierarchy at once with two contexts each
+ * @fwd: pointer to the context of the forward search
+ * @bwd: pointer to the context of the backward search
+ * @ch: pointer to the hierarchy
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+queue_t *ch_graph_r(dijkstra_ctx_t *fwd, dijkstra_ctx_t *bwd,
+	ch_graph_t const *ch, vertex_t const *start, vertex_t const *target)
+{
+	size_t meet;
+
+	if (!fwd || !bwd || !ch || !start || !target)
+		return (NULL);
+	meet = ch_search(fwd, bwd, ch, start->index, target->index);
+	if (meet == ch->nb_vertices)
+		return (NULL);
+	return (ch_path(fwd, bwd, ch, meet));
+}
+
+/**
+ * ch_graph - finds a shortest path with a contraction hierarchy,
+ * returning the same path queue as dijkstra_graph
+ * @ch: pointer to the hierarchy
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+queue_t *ch_graph(ch_graph_t const *ch, vertex_t const *start,
+	vertex_t const *target)
+{
+	dijkstra_ctx_t *fwd = dijkstra_ctx_create();
+	dijkstra_ctx_t *bwd = dijkstra_ctx_create();
+	queue_t *path = NULL;
+
+	if (fwd && bwd)
+		path = ch_graph_r(fwd, bwd, ch, start, target);
+	dijkstra_ctx_delete(fwd), dijkstra_ctx_delete(bwd);
+	return (path);
+}
@@ -0,0 +1,114 @@
+#include "pathfinding.h"
+
+/**
+ * ch_write_edges - writes hierarchy edges field by field, so that the
+ * file does not depend on the padding of ch_edge_t
+ * @file: file to write
+ * @edges: edges to write
+ * @nb_edges: number of edges
+ * Return: 1 on success, 0 on failure
+ */
+int ch_write_edges(FILE *file, ch_edge_t const *edges, size_t nb_edges)
+{
+	size_t e;
+
+	for (e = 0; e < nb_edges; e++)
+		if (fwrite(&edges[e].dest, sizeof(size_t), 1, file) != 1 ||
+			fwrite(&edges[e].weight, sizeof(int), 1, file) != 1 ||
+			fwrite(&edges[e].middle, sizeof(size_t), 1, file) != 1)
+			return (0);
+	return (1);
+}
+
+/**
+ * ch_read_edges - reads hierarchy edges written by ch_write_edges
+ * @file: file to read
+ * @edges: where to store the edges
+ * @nb_edges: number of edges
+ * Return: 1 on success, 0 on failure
+ */
+int ch_read_edges(FILE *file, ch_edge_t *edges, size_t nb_edges)
+{
+	size_t e;
+
+	for (e = 0; e < nb_edges; e++)
+		if (fread(&edges[e].dest, sizeof(size_t), 1, file) != 1 ||
+			fread(&edges[e].weight, sizeof(int), 1, file) != 1 ||
+			fread(&edges[e].middle, sizeof(size_t), 1, file) != 1)
+			return (0);
+	return (1);
+}
+
+/**
+ * ch_save - writes a contraction hierarchy to a binary file
+ * The file holds CH_MAGIC, the numbers of vertices, upward and downward
+ * edges, then the ranks and both edge arrays with their offsets, all in
+ * the byte order of the host. Vertices are only known by their index
+ * @ch: pointer to the hierarchy
+ * @path: path of the file to write
+ * Return: 1 on success, 0 on failure
+ */
+int ch_save(ch_graph_t const *ch, char const *path)
+{
+	FILE *file;
+	size_t n;
+	int ok;
+
+	if (!ch || !path)
+		return (0);
+	file = fopen(path, "wb");
+	if (!file)
+		return (0);
+	n = ch->nb_vertices;
+	ok = fwrite(CH_MAGIC, 1, 4, file) == 4 &&
+		fwrite(&ch->nb_vertices, sizeof(size_t), 1, file) == 1 &&
+		fwrite(&ch->nb_up, sizeof(size_t), 1, file) == 1 &&
+		fwrite(&ch->nb_down, sizeof(size_t), 1, file) == 1 &&
+		fwrite(ch->rank, sizeof(size_t), n, file) == n &&
+		fwrite(ch->up_offsets, sizeof(size_t), n + 1, file) == n + 1 &&
+		ch_write_edges(file, ch->up, ch->nb_up) &&
+		fwrite(ch->down_offsets, sizeof(size_t), n + 1, file) ==
+		n + 1 &&
+		ch_write_edges(file, ch->down, ch->nb_down);
+	if (fclose(file) != 0)
+		ok = 0;
+	return (ok);
+}
+
+/**
+ * ch_load - reads a contraction hierarchy written by ch_save
+ * The hierarchy is checked with ch_check before it is returned, so a
+ * corrupt or foreign file cannot make a query read out of bounds
+ * @path: path of the file to read
+ * @graph: pointer to the graph the hierarchy was built from, whose
+ *   vertices the hierarchy refers to
+ * Return: pointer to the hierarchy, NULL on failure or if the hierarchy
+ *   does not have as many vertices as @graph or is invalid
+ */
+ch_graph_t *ch_load(char const *path, graph_t const *graph)
+{
+	FILE *file;
+	ch_graph_t *ch = NULL;
+	size_t sizes[3], n;
+	char magic[4];
+	vertex_t *v;
+
+	file = path && graph ? fopen(path, "rb") : NULL;
+	if (!file)
+		return (NULL);
+	if (fread(magic, 1, 4, file) == 4 && !memcmp(magic, CH_MAGIC, 4) &&
+		fread(sizes, sizeof(size_t), 3, file) == 3 &&
+		sizes[0] == graph->nb_vertices)
+		ch = ch_alloc(sizes[0], sizes[1], sizes[2]);
+	n = ch ? ch->nb_vertices : 0;
+	if (ch && (fread(ch->rank, sizeof(size_t), n, file) != n ||
+		fread(ch->up_offsets, sizeof(size_t), n + 1, file) != n + 1 ||
+		!ch_read_edges(file, ch->up, ch->nb_up) ||
+		fread(ch->down_offsets, sizeof(size_t), n + 1, file) != n + 1 ||
+		!ch_read_edges(file, ch->down, ch->nb_down) || !ch_check(ch)))
+		ch_delete(ch), ch = NULL;
+	for (v = ch ? graph->vertices : NULL; v; v = v->next)
+		ch->vertices[v->index] = v;
+	fclose(file);
+	return (ch);
+}
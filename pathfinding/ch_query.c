@@ -0,0 +1,99 @@
+#include "pathfinding.h"
+
+/**
+ * ch_step - settles one vertex of one side of a contraction hierarchy
+ * query and relaxes its edges towards higher ranked vertices
+ * @ctx: pointer to the context of the side
+ * @other: pointer to the context of the other side
+ * @ch: pointer to the hierarchy
+ * @up: 1 for the forward side, 0 for the backward side
+ * @meet: pointer to the best meeting vertex found so far, updated when
+ *   the settled vertex was reached by the other side through a shorter path
+ */
+void ch_step(dijkstra_ctx_t *ctx, dijkstra_ctx_t const *other,
+	ch_graph_t const *ch, int up, size_t *meet)
+{
+	size_t const *offsets = up ? ch->up_offsets : ch->down_offsets;
+	ch_edge_t const *edges = up ? ch->up : ch->down;
+	size_t j, e, k;
+	int d;
+
+	j = min_heap_pop(&ctx->heap), ctx->nb_expanded++;
+	d = ctx->dists[j];
+	if (dijkstra_dist(other, j) != INT_MAX &&
+		d + dijkstra_dist(other, j) < bidir_best(ctx, other, *meet))
+		*meet = j;
+	for (e = offsets[j]; e < offsets[j + 1]; e++)
+	{
+		k = edges[e].dest;
+		if (!dijkstra_settled(ctx, k) &&
+			d + edges[e].weight < dijkstra_dist(ctx, k))
+			dijkstra_reach(ctx, k, d + edges[e].weight,
+				ch->vertices[j]);
+	}
+}
+
+/**
+ * ch_search - runs a bidirectional upward search in a contraction
+ * hierarchy, the forward side from the start vertex and the backward
+ * side from the target vertex
+ * A side stops once it cannot settle anything shorter than the best
+ * path found, which is then a shortest path
+ * @fwd: pointer to the context of the forward search
+ * @bwd: pointer to the context of the backward search
+ * @ch: pointer to the hierarchy
+ * @start: index of the starting vertex
+ * @target: index of the target vertex
+ * Return: index of the meeting vertex of a shortest path, or
+ *   @ch->nb_vertices if there is none or on failure
+ */
+size_t ch_search(dijkstra_ctx_t *fwd, dijkstra_ctx_t *bwd,
+	ch_graph_t const *ch, size_t start, size_t target)
+{
+	size_t meet = ch->nb_vertices;
+	int best, f, b;
+
+	if (!dijkstra_ctx_begin(fwd, ch->nb_vertices) ||
+		!dijkstra_ctx_begin(bwd, ch->nb_vertices))
+		return (ch->nb_vertices);
+	dijkstra_reach(fwd, start, 0, NULL);
+	dijkstra_reach(bwd, target, 0, NULL);
+	while (1)
+	{
+		best = bidir_best(fwd, bwd, meet);
+		f = bidir_top(fwd), b = bidir_top(bwd);
+		if (f >= best && b >= best)
+			break;
+		if (f <= b)
+			ch_step(fwd, bwd, ch, 1, &meet);
+		else
+			ch_step(bwd, fwd, ch, 0, &meet);
+	}
+	return (meet);
+}
+
+/**
+ * ch_find_edge - finds the hierarchy edge between two vertices
+ * An edge is stored with its lower ranked end: in @up for a forward edge,
+ * in @down for a backward one
+ * @ch: pointer to the hierarchy
+ * @a: index of the source of the edge
+ * @b: index of the destination of the edge
+ * Return: pointer to the edge, NULL if there is none
+ */
+ch_edge_t const *ch_find_edge(ch_graph_t const *ch, size_t a, size_t b)
+{
+	size_t e;
+
+	if (ch->rank[a] < ch->rank[b])
+	{
+		for (e = ch->up_offsets[a]; e < ch->up_offsets[a + 1]; e++)
+			if (ch->up[e].dest == b)
+				return (&ch->up[e]);
+		return (NULL);
+	}
+	for (e = ch->down_offsets[b]; e < ch->down_offsets[b + 1]; e++)
+		if (ch->down[e].dest == a)
+			return (&ch->down[e]);
+	return (NULL);
+}
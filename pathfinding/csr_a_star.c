@@ -0,0 +1,102 @@
+#include "pathfinding.h"
+
+/**
+ * csr_a_star_estimate - estimates the cost from a vertex of a CSR
+ * snapshot to the target with the heuristic selected in a query context
+ * @ctx: pointer to the query context
+ * @csr: pointer to the snapshot
+ * @k: index of the vertex to estimate from
+ * @target: index of the target vertex
+ * Return: the estimated cost
+ */
+size_t csr_a_star_estimate(dijkstra_ctx_t const *ctx,
+	csr_graph_t const *csr, size_t k, size_t target)
+{
+	if (ctx->heuristic)
+		return (ctx->heuristic(csr->vertices[k], csr->vertices[target],
+			ctx->heuristic_param));
+	return (h(csr->x[k], csr->y[k], csr->x[target], csr->y[target]));
+}
+
+/**
+ * csr_a_star_relax - relaxes the edges of a closed vertex of a
+ * CSR snapshot, keying reached vertices on g_score + h
+ * Like a_star_relax, closed vertices are updated but not reopened
+ * @ctx: pointer to the query context, whose dists hold the g_scores
+ * @csr: pointer to the snapshot
+ * @j: index of the closed vertex
+ * @target: index of the target vertex
+ */
+void csr_a_star_relax(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+	size_t j, size_t target)
+{
+	size_t e, k;
+	int g, closed;
+
+	for (e = csr->offsets[j]; e < csr->offsets[j + 1]; e++)
+	{
+		k = csr->dests[e], g = ctx->dists[j] + csr->weights[e];
+		closed = dijkstra_settled(ctx, k);
+		if (g >= dijkstra_dist(ctx, k))
+			continue;
+		ctx->stamps[k] = ctx->generation;
+		ctx->dists[k] = g, ctx->from[k] = csr->vertices[j];
+		if (!closed)
+			min_heap_push(&ctx->heap, k,
+				g + csr_a_star_estimate(ctx, csr, k, target));
+	}
+}
+
+/**
+ * csr_a_star_search - runs A* on a CSR snapshot with the heuristic
+ * selected in the query context until the target vertex is closed
+ * @ctx: pointer to the query context
+ * @csr: pointer to the snapshot
+ * @start: index of the starting vertex
+ * @target: index of the target vertex
+ * Return: 1 if @target was reached, 0 otherwise, -1 on failure
+ */
+int csr_a_star_search(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+	size_t start, size_t target)
+{
+	size_t j;
+
+	if (!dijkstra_ctx_begin(ctx, csr->nb_vertices))
+		return (-1);
+	ctx->stamps[start] = ctx->generation;
+	ctx->dists[start] = 0, ctx->from[start] = NULL;
+	min_heap_push(&ctx->heap, start,
+		csr_a_star_estimate(ctx, csr, start, target));
+	while (ctx->heap.size)
+	{
+		j = min_heap_pop(&ctx->heap), ctx->nb_expanded++;
+		if (ctx->trace)
+			printf("Checking %s, distance to %s is %lu\n",
+				csr->vertices[j]->content,
+				csr->vertices[target]->content,
+				csr_a_star_estimate(ctx, csr, j, target));
+		if (j == target)
+			return (1);
+		csr_a_star_relax(ctx, csr, j, target);
+	}
+	return (0);
+}
+
+/**
+ * csr_a_star_graph - a_star_graph on a CSR snapshot
+ * Like a_star_graph, a path from a vertex to itself is reported as none
+ * @ctx: pointer to the query context of the calling thread
+ * @csr: pointer to the snapshot
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+queue_t *csr_a_star_graph(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+	vertex_t const *start, vertex_t const *target)
+{
+	if (!ctx || !csr || !start || !target || start == target)
+		return (NULL);
+	if (csr_a_star_search(ctx, csr, start->index, target->index) != 1)
+		return (NULL);
+	return (dijkstra_path(ctx, target));
+}
@@ -0,0 +1,74 @@
+#include "pathfinding.h"
+
+/**
+ * csr_dijkstra_relax - relaxes the edges of a settled vertex of a
+ * CSR snapshot
+ * @ctx: pointer to the query context
+ * @csr: pointer to the snapshot
+ * @j: index of the settled vertex
+ */
+void csr_dijkstra_relax(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+	size_t j)
+{
+	size_t e, k;
+	int d = ctx->dists[j];
+
+	for (e = csr->offsets[j]; e < csr->offsets[j + 1]; e++)
+	{
+		k = csr->dests[e];
+		if (!dijkstra_settled(ctx, k) &&
+			d + csr->weights[e] < dijkstra_dist(ctx, k))
+			dijkstra_reach(ctx, k, d + csr->weights[e],
+				csr->vertices[j]);
+	}
+}
+
+/**
+ * csr_dijkstra_search - settles vertices of a CSR snapshot from a start
+ * vertex until the target vertex is settled
+ * @ctx: pointer to the query context
+ * @csr: pointer to the snapshot
+ * @start: index of the starting vertex
+ * @target: index of the target vertex, or csr->nb_vertices to settle
+ *   every reachable vertex
+ * Return: 1 if @target was settled, 0 otherwise, -1 on failure
+ */
+int csr_dijkstra_search(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+	size_t start, size_t target)
+{
+	size_t j;
+
+	if (!dijkstra_ctx_begin(ctx, csr->nb_vertices))
+		return (-1);
+	dijkstra_reach(ctx, start, 0, NULL);
+	while (ctx->heap.size)
+	{
+		j = min_heap_pop(&ctx->heap), ctx->nb_expanded++;
+		if (ctx->trace)
+			printf("Checking %s, distance from %s is %d\n",
+				csr->vertices[j]->content,
+				csr->vertices[start]->content, ctx->dists[j]);
+		csr_dijkstra_relax(ctx, csr, j);
+		if (j == target)
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * csr_dijkstra_graph - dijkstra_graph on a CSR snapshot
+ * @ctx: pointer to the query context of the calling thread
+ * @csr: pointer to the snapshot
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+queue_t *csr_dijkstra_graph(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+	vertex_t const *start, vertex_t const *target)
+{
+	if (!ctx || !csr || !start || !target)
+		return (NULL);
+	if (csr_dijkstra_search(ctx, csr, start->index, target->index) != 1)
+		return (NULL);
+	return (dijkstra_path(ctx, target));
+}
@@ -0,0 +1,114 @@
+#include "pathfinding.h"
+
+/**
+ * csr_graph_alloc - allocates the arrays of a CSR snapshot
+ * @nb_vertices: number of vertices
+ * @nb_edges: number of edges
+ * Return: pointer to the snapshot, NULL on failure
+ */
+csr_graph_t *csr_graph_alloc(size_t nb_vertices, size_t nb_edges)
+{
+	csr_graph_t *csr = calloc(1, sizeof(*csr));
+
+	if (!csr)
+		return (NULL);
+	csr->nb_vertices = nb_vertices, csr->nb_edges = nb_edges;
+	csr->offsets = malloc((nb_vertices + 1) * sizeof(*csr->offsets));
+	csr->dests = malloc((nb_edges + 1) * sizeof(*csr->dests));
+	csr->weights = malloc((nb_edges + 1) * sizeof(*csr->weights));
+	csr->x = malloc((nb_vertices + 1) * sizeof(*csr->x));
+	csr->y = malloc((nb_vertices + 1) * sizeof(*csr->y));
+	csr->vertices = malloc((nb_vertices + 1) * sizeof(*csr->vertices));
+	if (!csr->offsets || !csr->dests || !csr->weights || !csr->x ||
+		!csr->y || !csr->vertices)
+	{
+		csr_graph_delete(csr);
+		return (NULL);
+	}
+	return (csr);
+}
+
+/**
+ * csr_graph_delete - deallocates a CSR snapshot
+ * The graph it was built from is left untouched
+ * @csr: pointer to the snapshot
+ */
+void csr_graph_delete(csr_graph_t *csr)
+{
+	if (!csr)
+		return;
+	free(csr->offsets), free(csr->dests), free(csr->weights);
+	free(csr->x), free(csr->y), free(csr->vertices);
+	free(csr);
+}
+
+/**
+ * graph_freeze - builds an immutable CSR snapshot of a graph
+ * Edges of a vertex are stored contiguously, so searches on the snapshot
+ * read memory sequentially instead of chasing list pointers.
+ * The snapshot does not follow later changes to the graph, and its
+ * @vertices (and their contents) belong to the graph
+ * @graph: pointer to the graph
+ * Return: pointer to the snapshot, NULL on failure
+ */
+csr_graph_t *graph_freeze(graph_t const *graph)
+{
+	csr_graph_t *csr;
+	vertex_t *v;
+	edge_t *e;
+	size_t nb_edges = 0, i, k;
+
+	if (!graph)
+		return (NULL);
+	for (v = graph->vertices; v; v = v->next)
+		nb_edges += v->nb_edges;
+	csr = csr_graph_alloc(graph->nb_vertices, nb_edges);
+	if (!csr)
+		return (NULL);
+	for (v = graph->vertices; v; v = v->next)
+		csr->vertices[v->index] = v;
+	for (i = 0, k = 0; i < csr->nb_vertices; i++)
+	{
+		v = csr->vertices[i];
+		csr->offsets[i] = k, csr->x[i] = v->x, csr->y[i] = v->y;
+		for (e = v->edges; e && k < nb_edges; e = e->next, k++)
+		{
+			csr->dests[k] = e->dest->index;
+			csr->weights[k] = e->weight;
+		}
+	}
+	csr->offsets[i] = k, csr->nb_edges = k;
+	return (csr);
+}
+
+/**
+ * csr_transpose - builds the CSR snapshot of a graph with every edge
+ * reversed, so that the edges of a vertex lead to its predecessors
+ * @csr: pointer to the snapshot to transpose
+ * Return: pointer to the transposed snapshot, NULL on failure
+ */
+csr_graph_t *csr_transpose(csr_graph_t const *csr)
+{
+	csr_graph_t *rev = csr_graph_alloc(csr->nb_vertices, csr->nb_edges);
+	size_t i, e, *fill = calloc(csr->nb_vertices + 1, sizeof(*fill));
+
+	if (!rev || !fill)
+		return (csr_graph_delete(rev), free(fill), NULL);
+	memcpy(rev->x, csr->x, csr->nb_vertices * sizeof(*csr->x));
+	memcpy(rev->y, csr->y, csr->nb_vertices * sizeof(*csr->y));
+	memcpy(rev->vertices, csr->vertices,
+		csr->nb_vertices * sizeof(*csr->vertices));
+	for (e = 0; e < csr->nb_edges; e++)
+		fill[csr->dests[e] + 1]++;
+	for (i = 0; i < csr->nb_vertices; i++)
+		fill[i + 1] += fill[i];
+	memcpy(rev->offsets, fill, (csr->nb_vertices + 1) * sizeof(*fill));
+	for (i = 0; i < csr->nb_vertices; i++)
+		for (e = csr->offsets[i]; e < csr->offsets[i + 1]; e++)
+		{
+			rev->dests[fill[csr->dests[e]]] = i;
+			rev->weights[fill[csr->dests[e]]++] = csr->weights[e];
+		}
+	free(fill);
+	return (rev);
+}
@@ -0,0 +1,150 @@
+#include "pathfinding.h"
+
+/**
+ * dstep_push - appends a vertex to a bucket
+ * @bucket: pointer to the bucket
+ * @v: index of the vertex
+ * Return: 1 on success, 0 on failure
+ */
+int dstep_push(dstep_bucket_t *bucket, size_t v)
+{
+	size_t *items;
+
+	if (bucket->size == bucket->capacity)
+	{
+		items = realloc(bucket->items, (bucket->capacity * 2 + 16) *
+			sizeof(*items));
+		if (!items)
+			return (0);
+		bucket->items = items;
+		bucket->capacity = bucket->capacity * 2 + 16;
+	}
+	bucket->items[bucket->size++] = v;
+	return (1);
+}
+
+/**
+ * dstep_relax - lowers the distance of a vertex if a new one is shorter,
+ * and queues it in the bucket of its new distance
+ * Several threads may relax the same vertex at once; only the one whose
+ * compare-and-swap succeeds queues it
+ * @worker: the state of the thread
+ * @v: index of the vertex
+ * @dist: new distance of the vertex
+ */
+void dstep_relax(dstep_worker_t *worker, size_t v, int dist)
+{
+	dstep_t *ds = worker->ds;
+	int *slot = &ds->res->dists[v];
+	int old = __atomic_load_n(slot, __ATOMIC_RELAXED);
+
+	while (dist < old)
+	{
+		if (!__atomic_compare_exchange_n(slot, &old, dist, 0,
+			__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			continue;
+		if (!dstep_push(&worker->buckets[(size_t)(dist / ds->delta) %
+			ds->nb_buckets], v))
+			worker->failed = 1;
+		return;
+	}
+}
+
+/**
+ * dstep_light - relaxes the light edges of the vertices a thread queued
+ * in the current bucket
+ * Stale entries, whose vertex has since moved or was already relaxed at
+ * the same distance, are skipped
+ * @worker: the state of the thread
+ */
+void dstep_light(dstep_worker_t *worker)
+{
+	dstep_t *ds = worker->ds;
+	csr_graph_t const *csr = ds->csr;
+	dstep_bucket_t *slot, swap;
+	size_t i, v, e;
+	int d;
+
+	slot = &worker->buckets[ds->bucket % ds->nb_buckets];
+	swap = worker->frontier, worker->frontier = *slot, *slot = swap;
+	slot->size = 0;
+	for (i = 0; i < worker->frontier.size; i++)
+	{
+		v = worker->frontier.items[i];
+		d = __atomic_load_n(&ds->res->dists[v], __ATOMIC_RELAXED);
+		if ((size_t)(d / ds->delta) != ds->bucket ||
+			__atomic_exchange_n(&ds->relaxed[v], d,
+			__ATOMIC_RELAXED) == d)
+			continue;
+		if (__atomic_exchange_n(&ds->marks[v], ds->bucket + 1,
+			__ATOMIC_RELAXED) != ds->bucket + 1 &&
+			!dstep_push(&worker->settled, v))
+			worker->failed = 1;
+		for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+			if (csr->weights[e] <= ds->delta)
+				dstep_relax(worker, csr->dests[e],
+					d + csr->weights[e]);
+	}
+}
+
+/**
+ * dstep_heavy - relaxes the heavy edges of the vertices a thread took
+ * out of the current bucket, whose distances are now final
+ * @worker: the state of the thread
+ */
+void dstep_heavy(dstep_worker_t *worker)
+{
+	dstep_t *ds = worker->ds;
+	csr_graph_t const *csr = ds->csr;
+	size_t i, v, e;
+	int d;
+
+	for (i = 0; i < worker->settled.size; i++)
+	{
+		v = worker->settled.items[i];
+		d = ds->res->dists[v];
+		for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+			if (csr->weights[e] > ds->delta)
+				dstep_relax(worker, csr->dests[e],
+					d + csr->weights[e]);
+	}
+	worker->settled.size = 0;
+}
+
+/**
+ * dstep_worker - body of every thread of a delta-stepping search
+ * Thread 0 picks the next bucket while the others wait at the barrier,
+ * then all the threads empty it together, and finally pick the
+ * predecessors of their share of the vertices
+ * @arg: the state of the thread (dstep_worker_t *)
+ * Return: NULL
+ */
+void *dstep_worker(void *arg)
+{
+	dstep_worker_t *worker = arg;
+	dstep_t *ds = worker->ds;
+
+	pthread_mutex_lock(&ds->lock);
+	while (!ds->started)
+		pthread_cond_wait(&ds->start, &ds->lock);
+	pthread_mutex_unlock(&ds->lock);
+	while (1)
+	{
+		pthread_barrier_wait(&ds->barrier);
+		if (worker->id == 0)
+			dstep_next_bucket(ds);
+		pthread_barrier_wait(&ds->barrier);
+		if (ds->done)
+			break;
+		do {
+			dstep_light(worker);
+			pthread_barrier_wait(&ds->barrier);
+			if (worker->id == 0)
+				ds->again = dstep_pending(ds, ds->bucket);
+			pthread_barrier_wait(&ds->barrier);
+		} while (ds->again);
+		dstep_heavy(worker);
+	}
+	dstep_preds(worker);
+	return (NULL);
+}
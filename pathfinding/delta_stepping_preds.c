@@ -0,0 +1,111 @@
+#include "pathfinding.h"
+
+/**
+ * dstep_pending - checks whether any thread queued vertices in the
+ * circular slot of a bucket
+ * @ds: the state of the search, with every thread stopped at the barrier
+ * @bucket: the bucket
+ * Return: 1 if the slot holds vertices, 0 otherwise
+ */
+int dstep_pending(dstep_t *ds, size_t bucket)
+{
+	size_t i;
+
+	for (i = 0; i < ds->nb_threads; i++)
+		if (ds->workers[i].buckets[bucket % ds->nb_buckets].size)
+			return (1);
+	return (0);
+}
+
+/**
+ * dstep_next_bucket - moves a search to its lowest non-empty bucket
+ * An edge never reaches further than @ds->nb_buckets - 1 buckets ahead,
+ * so one turn of the circular slots is enough to find it
+ * @ds: the state of the search, with every thread stopped at the barrier
+ */
+void dstep_next_bucket(dstep_t *ds)
+{
+	size_t k;
+
+	for (k = 0; k < ds->nb_buckets; k++)
+	{
+		if (dstep_pending(ds, ds->bucket + k))
+		{
+			ds->bucket += k;
+			return;
+		}
+	}
+	ds->done = 1;
+}
+
+/**
+ * dstep_preds - picks the predecessor of each vertex of a thread's share
+ * The predecessor is the in-neighbor u at a strictly lower distance that
+ * lies on a shortest path and comes first in (distance, index) order,
+ * which is the vertex Dijkstra's algorithm reaches it from when all
+ * weights are positive
+ * @worker: the state of the thread
+ */
+void dstep_preds(dstep_worker_t *worker)
+{
+	dstep_t *ds = worker->ds;
+	csr_graph_t const *rev = ds->rev;
+	int const *dists = ds->res->dists;
+	size_t v, hi, e, u, best;
+
+	v = rev->nb_vertices * worker->id / ds->nb_threads;
+	hi = rev->nb_vertices * (worker->id + 1) / ds->nb_threads;
+	for (; v < hi; v++)
+	{
+		best = SSSP_NO_PRED;
+		for (e = rev->offsets[v]; dists[v] != INT_MAX &&
+			e < rev->offsets[v + 1]; e++)
+		{
+			u = rev->dests[e];
+			if (dists[u] >= dists[v] ||
+				dists[u] + rev->weights[e] != dists[v])
+				continue;
+			if (best == SSSP_NO_PRED || dists[u] < dists[best] ||
+				(dists[u] == dists[best] && u < best))
+				best = u;
+		}
+		ds->res->preds[v] = best;
+	}
+}
+
+/**
+ * dstep_zero_preds - picks the predecessors of the vertices only reached
+ * through edges of weight 0, by a breadth-first search along such edges
+ * from the vertices that already have one
+ * @ds: the state of the search, once every thread is done
+ * Return: 1 on success, 0 on failure
+ */
+int dstep_zero_preds(dstep_t *ds)
+{
+	csr_graph_t const *csr = ds->csr;
+	sssp_t *res = ds->res;
+	size_t *queue, head = 0, tail = 0, v, e, k;
+
+	queue = malloc((csr->nb_vertices + 1) * sizeof(*queue));
+	if (!queue)
+		return (0);
+	for (v = 0; v < csr->nb_vertices; v++)
+		if (res->dists[v] != INT_MAX &&
+			(v == res->source || res->preds[v] != SSSP_NO_PRED))
+			queue[tail++] = v;
+	while (head < tail)
+	{
+		v = queue[head++];
+		for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+		{
+			k = csr->dests[e];
+			if (csr->weights[e] || k == res->source ||
+				res->dists[k] != res->dists[v] ||
+				res->preds[k] != SSSP_NO_PRED)
+				continue;
+			res->preds[k] = v, queue[tail++] = k;
+		}
+	}
+	free(queue);
+	return (1);
+}
@@ -0,0 +1,164 @@
+#include "pathfinding.h"
+
+/**
+ * dstep_create - allocates the state of a delta-stepping search
+ * @csr: the snapshot to search
+ * @rev: the transposed snapshot
+ * @delta: the width of a bucket
+ * @nb_threads: the number of threads to use
+ * Return: a pointer to the state, or NULL on failure
+ */
+dstep_t *dstep_create(csr_graph_t const *csr, csr_graph_t const *rev,
+	int delta, size_t nb_threads)
+{
+	dstep_t *ds = calloc(1, sizeof(*ds));
+	size_t i;
+	int max = 0, ok;
+
+	if (!ds)
+		return (NULL);
+	for (i = 0; i < csr->nb_edges; i++)
+		if (csr->weights[i] > max)
+			max = csr->weights[i];
+	ds->csr = csr, ds->rev = rev, ds->delta = delta;
+	ds->nb_buckets = max / delta + 2, ds->nb_threads = nb_threads;
+	ds->res = sssp_alloc(csr->nb_vertices);
+	ds->relaxed = malloc((csr->nb_vertices + 1) * sizeof(*ds->relaxed));
+	ds->marks = calloc(csr->nb_vertices + 1, sizeof(*ds->marks));
+	ds->workers = calloc(nb_threads, sizeof(*ds->workers));
+	ok = ds->res && ds->relaxed && ds->marks && ds->workers;
+	for (i = 0; ok && i < nb_threads; i++)
+	{
+		ds->workers[i].ds = ds, ds->workers[i].id = i;
+		ds->workers[i].buckets = calloc(ds->nb_buckets,
+			sizeof(dstep_bucket_t));
+		ok = ds->workers[i].buckets != NULL;
+	}
+	if (!ok)
+		return (sssp_delete(ds->res), dstep_delete(ds), NULL);
+	for (i = 0; i < csr->nb_vertices; i++)
+		ds->res->dists[i] = INT_MAX, ds->relaxed[i] = -1;
+	memcpy(ds->res->vertices, csr->vertices,
+		csr->nb_vertices * sizeof(*csr->vertices));
+	pthread_mutex_init(&ds->lock, NULL);
+	pthread_cond_init(&ds->start, NULL);
+	return (ds);
+}
+
+/**
+ * dstep_delete - frees the state of a delta-stepping search, except for
+ * its result
+ * @ds: a pointer to the state
+ */
+void dstep_delete(dstep_t *ds)
+{
+	dstep_worker_t *w;
+	size_t i;
+
+	if (!ds)
+		return;
+	for (w = ds->workers; w && w < ds->workers + ds->nb_threads; w++)
+	{
+		for (i = 0; w->buckets && i < ds->nb_buckets; i++)
+			free(w->buckets[i].items);
+		free(w->buckets), free(w->frontier.items);
+		free(w->settled.items);
+	}
+	free(ds->workers), free(ds->relaxed), free(ds->marks);
+	free(ds);
+}
+
+/**
+ * dstep_launch - starts the threads of a delta-stepping search
+ * The threads wait until they are all created, so a failed creation
+ * only lowers the number of threads taking part
+ * @ds: a pointer to the state
+ */
+void dstep_launch(dstep_t *ds)
+{
+	size_t i;
+
+	for (i = 1; i < ds->nb_threads; i++)
+	{
+		if (pthread_create(&ds->workers[i].thread, NULL, dstep_worker,
+			&ds->workers[i]) != 0)
+			break;
+	}
+	pthread_mutex_lock(&ds->lock);
+	ds->nb_threads = i;
+	pthread_barrier_init(&ds->barrier, NULL, i);
+	ds->started = 1;
+	pthread_cond_broadcast(&ds->start);
+	pthread_mutex_unlock(&ds->lock);
+}
+
+/**
+ * delta_stepping - computes the distance of every vertex from a source
+ * with a parallel delta-stepping search
+ * Distances are the same as Dijkstra's, and so are the paths sssp_path
+ * builds as long as no edge weighs 0
+ * @csr: the snapshot to search, whose weights must not be negative
+ * @rev: the transposed snapshot (csr_transpose)
+ * @source: the index of the source vertex
+ * @delta: the width of a bucket, below 1 meaning 1; edges up to @delta
+ *   are relaxed as often as needed inside a bucket, heavier ones once
+ * @nb_threads: the number of threads to use, the caller being one of them
+ * Return: distances and predecessors of every vertex, to be freed with
+ *   sssp_delete, or NULL on failure
+ */
+sssp_t *delta_stepping(csr_graph_t const *csr, csr_graph_t const *rev,
+	size_t source, int delta, size_t nb_threads)
+{
+	dstep_t *ds;
+	sssp_t *res = NULL;
+	size_t i;
+	int ok = 1;
+
+	if (!csr || !rev || source >= csr->nb_vertices)
+		return (NULL);
+	ds = dstep_create(csr, rev, delta < 1 ? 1 : delta,
+		nb_threads ? nb_threads : 1);
+	if (!ds)
+		return (NULL);
+	ds->res->dists[source] = 0, ds->res->source = source;
+	if (!dstep_push(&ds->workers[0].buckets[0], source))
+		ds->workers[0].failed = 1;
+	dstep_launch(ds);
+	dstep_worker(&ds->workers[0]);
+	for (i = 1; i < ds->nb_threads; i++)
+		pthread_join(ds->workers[i].thread, NULL);
+	pthread_barrier_destroy(&ds->barrier);
+	pthread_mutex_destroy(&ds->lock), pthread_cond_destroy(&ds->start);
+	for (i = 0; i < ds->nb_threads; i++)
+		ok = ok && !ds->workers[i].failed;
+	if (ok && dstep_zero_preds(ds))
+		res = ds->res;
+	else
+		sssp_delete(ds->res);
+	dstep_delete(ds);
+	return (res);
+}
+
+/**
+ * delta_stepping_graph - runs delta_stepping on a graph
+ * The graph is snapshotted and transposed on every call; callers running
+ * many searches on the same graph should keep the snapshots
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @delta: the width of a bucket
+ * @nb_threads: the number of threads to use
+ * Return: distances and predecessors of every vertex, or NULL on failure
+ */
+sssp_t *delta_stepping_graph(graph_t *graph, vertex_t const *start,
+	int delta, size_t nb_threads)
+{
+	csr_graph_t *csr = graph_freeze(graph), *rev = NULL;
+	sssp_t *res = NULL;
+
+	if (csr)
+		rev = csr_transpose(csr);
+	if (rev && start)
+		res = delta_stepping(csr, rev, start->index, delta, nb_threads);
+	csr_graph_delete(csr), csr_graph_delete(rev);
+	return (res);
+}
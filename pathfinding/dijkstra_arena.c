@@ -0,0 +1,49 @@
+#include "pathfinding.h"
+
+/**
+ * dijkstra_path_arena - builds the path found by the last query of a
+ * context in an arena queue
+ * The names are copied into the arena of the queue, so the whole path is
+ * a handful of allocations freed by arena_queue_delete
+ * @ctx: pointer to the query context
+ * @target: pointer to the settled target vertex
+ * Return: queue of the names of the vertices from start to @target,
+ *   NULL on failure
+ */
+arena_queue_t *dijkstra_path_arena(dijkstra_ctx_t const *ctx,
+	vertex_t const *target)
+{
+	arena_queue_t *path = arena_queue_create();
+	char *str;
+
+	if (!path)
+		return (NULL);
+	for (; target; target = ctx->from[target->index])
+	{
+		str = arena_strdup(&path->arena, target->content);
+		if (!str || !arena_queue_push_front(path, str))
+		{
+			arena_queue_delete(path);
+			return (NULL);
+		}
+	}
+	return (path);
+}
+
+/**
+ * dijkstra_graph_arena_r - dijkstra_graph_r returning an arena queue
+ * @ctx: pointer to the query context of the calling thread
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+arena_queue_t *dijkstra_graph_arena_r(dijkstra_ctx_t *ctx,
+	graph_t const *graph, vertex_t const *start, vertex_t const *target)
+{
+	if (!ctx || !graph || !start || !target)
+		return (NULL);
+	if (dijkstra_search(ctx, graph, start, target) != 1)
+		return (NULL);
+	return (dijkstra_path_arena(ctx, target));
+}
@@ -0,0 +1,91 @@
+#include "pathfinding.h"
+
+/**
+ * dijkstra_ctx_create - allocates an empty Dijkstra query context
+ * The buffers are allocated by the first query that uses the context
+ * Return: pointer to the context, NULL on failure
+ */
+dijkstra_ctx_t *dijkstra_ctx_create(void)
+{
+	return (calloc(1, sizeof(dijkstra_ctx_t)));
+}
+
+/**
+ * dijkstra_ctx_delete - deallocates a Dijkstra query context
+ * @ctx: pointer to the context
+ */
+void dijkstra_ctx_delete(dijkstra_ctx_t *ctx)
+{
+	if (!ctx)
+		return;
+	free(ctx->stamps), free(ctx->dists), free(ctx->from), free(ctx->verts);
+	min_heap_free(&ctx->heap);
+	free(ctx);
+}
+
+/**
+ * dijkstra_ctx_reserve - resizes the buffers of a context
+ * @ctx: pointer to the context
+ * @capacity: number of vertices the buffers must hold
+ * Return: 1 on success, 0 on failure
+ */
+int dijkstra_ctx_reserve(dijkstra_ctx_t *ctx, size_t capacity)
+{
+	free(ctx->stamps), free(ctx->dists), free(ctx->from), free(ctx->verts);
+	min_heap_free(&ctx->heap);
+	ctx->stamps = calloc(capacity, sizeof(*ctx->stamps));
+	ctx->dists = malloc(capacity * sizeof(*ctx->dists));
+	ctx->from = malloc(capacity * sizeof(*ctx->from));
+	ctx->verts = malloc(capacity * sizeof(*ctx->verts));
+	ctx->capacity = capacity, ctx->generation = 0;
+	if (ctx->stamps && ctx->dists && ctx->from && ctx->verts &&
+		min_heap_init(&ctx->heap, capacity))
+		return (1);
+	free(ctx->stamps), free(ctx->dists), free(ctx->from), free(ctx->verts);
+	ctx->stamps = NULL, ctx->dists = NULL;
+	ctx->from = NULL, ctx->verts = NULL;
+	ctx->capacity = 0;
+	return (0);
+}
+
+/**
+ * dijkstra_ctx_begin - starts a new query on a context
+ * Bumping the generation invalidates every entry left by the last query
+ * @ctx: pointer to the context
+ * @nb_vertices: number of vertices of the graph to search
+ * Return: 1 on success, 0 on failure
+ */
+int dijkstra_ctx_begin(dijkstra_ctx_t *ctx, size_t nb_vertices)
+{
+	if (nb_vertices > ctx->capacity &&
+		!dijkstra_ctx_reserve(ctx, nb_vertices))
+		return (0);
+	if (++ctx->generation == 0)
+	{
+		memset(ctx->stamps, 0, ctx->capacity * sizeof(*ctx->stamps));
+		ctx->generation = 1;
+	}
+	ctx->heap.size = 0, ctx->nb_expanded = 0;
+	return (1);
+}
+
+/**
+ * dijkstra_ctx_prepare - gets a context ready for a new query on a graph
+ * The index-to-vertex table is rebuilt by every query, as a graph may
+ * have been modified, or freed and another one allocated at the same
+ * address, since the last one. It costs O(V), like the query itself
+ * @ctx: pointer to the context
+ * @graph: pointer to the graph to search, which must not be modified
+ *   while contexts are using it
+ * Return: 1 on success, 0 on failure
+ */
+int dijkstra_ctx_prepare(dijkstra_ctx_t *ctx, graph_t const *graph)
+{
+	vertex_t *v;
+
+	if (!dijkstra_ctx_begin(ctx, graph->nb_vertices))
+		return (0);
+	for (v = graph->vertices; v; v = v->next)
+		ctx->verts[v->index] = v;
+	return (1);
+}
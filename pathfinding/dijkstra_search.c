@@ -0,0 +1,95 @@
+#include "pathfinding.h"
+
+/**
+ * dijkstra_dist - gets the distance of a vertex in the current query
+ * @ctx: pointer to the query context
+ * @i: index of the vertex
+ * Return: the tentative or final distance, INT_MAX if unreached
+ */
+int dijkstra_dist(dijkstra_ctx_t const *ctx, size_t i)
+{
+	if (ctx->stamps[i] != ctx->generation)
+		return (INT_MAX);
+	return (ctx->dists[i]);
+}
+
+/**
+ * dijkstra_settled - checks whether the distance of a vertex is final
+ * A reached vertex is settled once it has been popped from the heap
+ * @ctx: pointer to the query context
+ * @i: index of the vertex
+ * Return: 1 if the vertex is settled, 0 otherwise
+ */
+int dijkstra_settled(dijkstra_ctx_t const *ctx, size_t i)
+{
+	return (ctx->stamps[i] == ctx->generation &&
+		!min_heap_contains(&ctx->heap, i));
+}
+
+/**
+ * dijkstra_reach - records a shorter distance to a vertex
+ * @ctx: pointer to the query context
+ * @i: index of the vertex
+ * @dist: new distance of the vertex
+ * @from: vertex it is reached from, NULL for the start vertex
+ */
+void dijkstra_reach(dijkstra_ctx_t *ctx, size_t i, int dist,
+	vertex_t *from)
+{
+	ctx->stamps[i] = ctx->generation;
+	ctx->dists[i] = dist, ctx->from[i] = from;
+	min_heap_push(&ctx->heap, i, dist);
+}
+
+/**
+ * dijkstra_relax - relaxes the edges of a settled vertex
+ * @ctx: pointer to the query context
+ * @j: index of the settled vertex
+ */
+void dijkstra_relax(dijkstra_ctx_t *ctx, size_t j)
+{
+	edge_t *e;
+	size_t k;
+
+	for (e = ctx->verts[j]->edges; e; e = e->next)
+	{
+		k = e->dest->index;
+		if (!dijkstra_settled(ctx, k) &&
+			ctx->dists[j] + e->weight < dijkstra_dist(ctx, k))
+			dijkstra_reach(ctx, k, ctx->dists[j] + e->weight,
+				ctx->verts[j]);
+	}
+}
+
+/**
+ * dijkstra_search - settles vertices from a start vertex until the
+ * target vertex is settled
+ * Only @ctx is written to, so queries sharing a graph can run in
+ * parallel as long as each one has its own context
+ * @ctx: pointer to the query context
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex, NULL to settle every reachable vertex
+ * Return: 1 if @target was settled, 0 otherwise, -1 on failure
+ */
+int dijkstra_search(dijkstra_ctx_t *ctx, graph_t const *graph,
+	vertex_t const *start, vertex_t const *target)
+{
+	size_t j;
+
+	if (!dijkstra_ctx_prepare(ctx, graph))
+		return (-1);
+	dijkstra_reach(ctx, start->index, 0, NULL);
+	while (ctx->heap.size)
+	{
+		j = min_heap_pop(&ctx->heap), ctx->nb_expanded++;
+		if (ctx->trace)
+			printf("Checking %s, distance from %s is %d\n",
+				ctx->verts[j]->content, start->content,
+				ctx->dists[j]);
+		dijkstra_relax(ctx, j);
+		if (target && j == target->index)
+			return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,55 @@
+#include "pathfinding.h"
+
+/**
+ * grid_init_rows - makes a grid read an array of rows in place
+ * @grid: pointer to the grid to initialize
+ * @map: array of @rows rows of @cols cells, which must outlive @grid
+ * @rows: number of rows
+ * @cols: number of columns
+ */
+void grid_init_rows(grid_t *grid, char * const *map, int rows, int cols)
+{
+	grid->rows = rows, grid->cols = cols;
+	grid->cells = NULL, grid->stride = 0, grid->lines = map;
+}
+
+/**
+ * grid_init_flat - makes a grid read a flat row-major buffer in place
+ * @grid: pointer to the grid to initialize
+ * @cells: buffer of @rows * @cols cells, which must outlive @grid
+ * @rows: number of rows
+ * @cols: number of columns
+ */
+void grid_init_flat(grid_t *grid, char const *cells, int rows, int cols)
+{
+	grid->rows = rows, grid->cols = cols;
+	grid->cells = cells, grid->stride = cols, grid->lines = NULL;
+}
+
+/**
+ * grid_open - checks whether a cell of a grid is walkable
+ * @grid: pointer to the grid
+ * @x: column of the cell
+ * @y: row of the cell
+ * Return: 1 if the cell is inside the grid and holds '0', 0 otherwise
+ */
+int grid_open(grid_t const *grid, int x, int y)
+{
+	if (x < 0 || x >= grid->cols || y < 0 || y >= grid->rows)
+		return (0);
+	if (grid->cells)
+		return (grid->cells[(size_t)y * grid->stride + x] == '0');
+	return (grid->lines[y][x] == '0');
+}
+
+/**
+ * grid_path_delete - deallocates a grid path
+ * @path: pointer to the path
+ */
+void grid_path_delete(grid_path_t *path)
+{
+	if (!path)
+		return;
+	free(path->points);
+	free(path);
+}
@@ -0,0 +1,72 @@
+#include "pathfinding.h"
+
+/**
+ * grid_a_star_expand - reaches the walkable neighbors of an expanded cell
+ * Each step costs 1 and the heuristic is the Manhattan distance to the
+ * target, which never overestimates on a 4-connected grid
+ * @search: pointer to the scratch space
+ * @cell: index of the expanded cell
+ * @target: target point
+ */
+void grid_a_star_expand(grid_search_t *search, size_t cell,
+	point_t const *target)
+{
+	size_t cols = search->grid->cols, next;
+	int d, x, y, nx, ny, g = search->g[cell] + 1;
+
+	x = cell % cols, y = cell / cols;
+	for (d = 0; d < 4; d++)
+	{
+		nx = x + GRID_DX(d), ny = y + GRID_DY(d);
+		if (!grid_open(search->grid, nx, ny))
+			continue;
+		next = (size_t)ny * cols + nx;
+		if (g >= search->g[next] ||
+			search->visited[next / GRID_WORD_BITS] &
+			(1UL << (next % GRID_WORD_BITS)))
+			continue;
+		search->g[next] = g, search->dirs[next] = d;
+		min_heap_push(&search->heap, next, g +
+			abs(target->x - nx) + abs(target->y - ny));
+	}
+}
+
+/**
+ * grid_a_star - finds a shortest path between two cells of a grid with
+ * an A* search, moving right, down, left or up
+ * The grid is read in place, expanded cells being tracked in a bitset
+ * @grid: pointer to the grid
+ * @start: start point
+ * @target: target point
+ * Return: pointer to the path, NULL if there is none or on failure
+ */
+grid_path_t *grid_a_star(grid_t const *grid, point_t const *start,
+	point_t const *target)
+{
+	grid_search_t search;
+	grid_path_t *path = NULL;
+	size_t cell, cols;
+
+	if (!grid || !start || !target ||
+		!grid_open(grid, start->x, start->y) ||
+		!grid_search_init(&search, grid, 1))
+		return (NULL);
+	cols = grid->cols;
+	cell = (size_t)start->y * cols + start->x;
+	search.g[cell] = 0;
+	min_heap_push(&search.heap, cell, 0);
+	while (search.heap.size)
+	{
+		cell = min_heap_pop(&search.heap);
+		grid_visit(&search, cell);
+		if ((int)(cell % cols) == target->x &&
+			(int)(cell / cols) == target->y)
+		{
+			path = grid_path_build(&search, start, target);
+			break;
+		}
+		grid_a_star_expand(&search, cell, target);
+	}
+	grid_search_free(&search);
+	return (path);
+}
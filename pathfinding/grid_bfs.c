@@ -0,0 +1,48 @@
+#include "pathfinding.h"
+
+/**
+ * grid_bfs - finds a shortest path between two cells of a grid with a
+ * breadth-first search, moving right, down, left or up
+ * The grid is read in place, visited cells being tracked in a bitset
+ * @grid: pointer to the grid
+ * @start: start point
+ * @target: target point
+ * Return: pointer to the path, NULL if there is none or on failure
+ */
+grid_path_t *grid_bfs(grid_t const *grid, point_t const *start,
+	point_t const *target)
+{
+	grid_search_t search;
+	grid_path_t *path = NULL;
+	size_t head = 0, tail = 0, cell, next, cols;
+	int d, x, y;
+
+	if (!grid || !start || !target ||
+		!grid_open(grid, start->x, start->y) ||
+		!grid_search_init(&search, grid, 0))
+		return (NULL);
+	cols = grid->cols;
+	cell = (size_t)start->y * cols + start->x;
+	grid_visit(&search, cell), search.queue[tail++] = cell;
+	while (head < tail)
+	{
+		cell = search.queue[head++];
+		x = cell % cols, y = cell / cols;
+		if (x == target->x && y == target->y)
+		{
+			path = grid_path_build(&search, start, target);
+			break;
+		}
+		for (d = 0; d < 4; d++)
+		{
+			if (!grid_open(grid, x + GRID_DX(d), y + GRID_DY(d)))
+				continue;
+			next = (size_t)(y + GRID_DY(d)) * cols + x + GRID_DX(d);
+			if (!grid_visit(&search, next))
+				continue;
+			search.dirs[next] = d, search.queue[tail++] = next;
+		}
+	}
+	grid_search_free(&search);
+	return (path);
+}
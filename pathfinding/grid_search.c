@@ -0,0 +1,98 @@
+#include "pathfinding.h"
+
+/**
+ * grid_search_init - allocates the scratch space of a grid search
+ * @search: pointer to the scratch space
+ * @grid: pointer to the grid to search
+ * @a_star: 1 for an A* search, 0 for a breadth-first search
+ * Return: 1 on success, 0 on failure
+ */
+int grid_search_init(grid_search_t *search, grid_t const *grid, int a_star)
+{
+	size_t i, n = (size_t)grid->rows * grid->cols;
+	int ok;
+
+	memset(search, 0, sizeof(*search));
+	search->grid = grid, search->nb_cells = n;
+	search->visited = calloc(n / GRID_WORD_BITS + 1,
+		sizeof(*search->visited));
+	search->dirs = malloc(n + 1);
+	if (a_star)
+		search->g = malloc((n + 1) * sizeof(*search->g));
+	else
+		search->queue = malloc((n + 1) * sizeof(*search->queue));
+	ok = search->visited && search->dirs &&
+		(a_star ? search->g && min_heap_init(&search->heap, n + 1) :
+		search->queue != NULL);
+	for (i = 0; ok && a_star && i < n; i++)
+		search->g[i] = INT_MAX;
+	if (!ok)
+		grid_search_free(search);
+	return (ok);
+}
+
+/**
+ * grid_search_free - deallocates the scratch space of a grid search
+ * @search: pointer to the scratch space
+ */
+void grid_search_free(grid_search_t *search)
+{
+	free(search->visited), free(search->dirs);
+	free(search->queue), free(search->g);
+	min_heap_free(&search->heap);
+	search->visited = NULL, search->dirs = NULL;
+	search->queue = NULL, search->g = NULL;
+}
+
+/**
+ * grid_visit - marks a cell as visited
+ * @search: pointer to the scratch space
+ * @cell: index of the cell, row * cols + column
+ * Return: 1 if the cell was not visited yet, 0 otherwise
+ */
+int grid_visit(grid_search_t *search, size_t cell)
+{
+	unsigned long *word = &search->visited[cell / GRID_WORD_BITS];
+	unsigned long bit = 1UL << (cell % GRID_WORD_BITS);
+
+	if (*word & bit)
+		return (0);
+	*word |= bit;
+	return (1);
+}
+
+/**
+ * grid_path_build - builds the path to a cell by following the moves
+ * that reached each cell back to the start
+ * @search: pointer to the scratch space of a search that reached @target
+ * @start: start point
+ * @target: target point
+ * Return: pointer to the path, NULL on failure
+ */
+grid_path_t *grid_path_build(grid_search_t const *search,
+	point_t const *start, point_t const *target)
+{
+	grid_path_t *path = calloc(1, sizeof(*path));
+	size_t cols = search->grid->cols, n = 1;
+	point_t p = *target;
+	int d;
+
+	if (!path)
+		return (NULL);
+	for (; p.x != start->x || p.y != start->y; n++)
+	{
+		d = search->dirs[(size_t)p.y * cols + p.x];
+		p.x -= GRID_DX(d), p.y -= GRID_DY(d);
+	}
+	path->points = malloc(n * sizeof(*path->points));
+	if (!path->points)
+		return (free(path), NULL);
+	for (path->length = n, p = *target; n > 1;)
+	{
+		path->points[--n] = p;
+		d = search->dirs[(size_t)p.y * cols + p.x];
+		p.x -= GRID_DX(d), p.y -= GRID_DY(d);
+	}
+	path->points[0] = p;
+	return (path);
+}
@@ -0,0 +1,89 @@
+#include "pathfinding.h"
+#include <math.h>
+
+#define UNIT(param) ((param) ? *(size_t const *)(param) : 1)
+#define DELTA(a, b) ((size_t)((a) > (b) ? (long)(a) - (b) : (long)(b) - (a)))
+
+/**
+ * h - Euclidean distance between two points, used as A* heuristic
+ * @x1: X coordinate of the first point
+ * @y1: Y coordinate of the first point
+ * @x2: X coordinate of the second point
+ * @y2: Y coordinate of the second point
+ * Return: the distance, rounded down
+ */
+size_t h(int x1, int y1, int x2, int y2)
+{
+	double dx = (double)x2 - x1, dy = (double)y2 - y1;
+
+	return ((size_t)sqrt(dx * dx + dy * dy));
+}
+
+/**
+ * heuristic_euclidean - h() as a pluggable heuristic
+ * @v: vertex to estimate from
+ * @target: target vertex
+ * @param: cost of one unit of distance (size_t const *), NULL for 1
+ * Return: the estimated cost
+ */
+size_t heuristic_euclidean(vertex_t const *v, vertex_t const *target,
+	void const *param)
+{
+	return (UNIT(param) * h(v->x, v->y, target->x, target->y));
+}
+
+/**
+ * heuristic_manhattan - |dx| + |dy|, exact on an empty 4-connected grid
+ * @v: vertex to estimate from
+ * @target: target vertex
+ * @param: cost of one unit of distance (size_t const *), NULL for 1
+ * Return: the estimated cost
+ */
+size_t heuristic_manhattan(vertex_t const *v, vertex_t const *target,
+	void const *param)
+{
+	size_t dx = DELTA(v->x, target->x), dy = DELTA(v->y, target->y);
+
+	return (UNIT(param) * (dx + dy));
+}
+
+/**
+ * heuristic_octile - exact cost on an empty 8-connected grid:
+ * straight * (max - min) + diagonal * min of |dx| and |dy|
+ * Without costs, straight moves cost 1 and diagonal ones sqrt(2), taken
+ * as 92681 / 65536, just below its real value, so the estimate stays
+ * admissible without floating point
+ * @v: vertex to estimate from
+ * @target: target vertex
+ * @param: move costs (octile_cost_t const *), NULL for 1 and sqrt(2)
+ * Return: the estimated cost
+ */
+size_t heuristic_octile(vertex_t const *v, vertex_t const *target,
+	void const *param)
+{
+	octile_cost_t const *cost = param;
+	size_t dx = DELTA(v->x, target->x), dy = DELTA(v->y, target->y);
+	size_t lo = dx < dy ? dx : dy, hi = dx < dy ? dy : dx, diagonal;
+
+	if (!cost)
+		return (((hi - lo) * 65536 + lo * 92681) >> 16);
+	diagonal = cost->diagonal < 2 * cost->straight ?
+		cost->diagonal : 2 * cost->straight;
+	return (cost->straight * (hi - lo) + diagonal * lo);
+}
+
+/**
+ * heuristic_chebyshev - max(|dx|, |dy|), exact on an empty 8-connected
+ * grid whose diagonal moves cost the same as straight ones
+ * @v: vertex to estimate from
+ * @target: target vertex
+ * @param: cost of one unit of distance (size_t const *), NULL for 1
+ * Return: the estimated cost
+ */
+size_t heuristic_chebyshev(vertex_t const *v, vertex_t const *target,
+	void const *param)
+{
+	size_t dx = DELTA(v->x, target->x), dy = DELTA(v->y, target->y);
+
+	return (UNIT(param) * (dx < dy ? dy : dx));
+}
@@ -0,0 +1,23 @@
+#include "pathfinding.h"
+
+/**
+ * heuristic_get - gets a built-in A* heuristic
+ * The result is meant for the heuristic field of a dijkstra_ctx_t
+ * @type: heuristic to get
+ * Return: pointer to the heuristic, NULL for an unknown type
+ */
+heuristic_t heuristic_get(heuristic_type_t type)
+{
+	switch (type)
+	{
+	case HEURISTIC_EUCLIDEAN:
+		return (heuristic_euclidean);
+	case HEURISTIC_MANHATTAN:
+		return (heuristic_manhattan);
+	case HEURISTIC_OCTILE:
+		return (heuristic_octile);
+	case HEURISTIC_CHEBYSHEV:
+		return (heuristic_chebyshev);
+	}
+	return (NULL);
+}
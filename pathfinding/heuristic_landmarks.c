@@ -0,0 +1,40 @@
+#include "pathfinding.h"
+
+/**
+ * heuristic_landmarks - ALT heuristic: the largest triangle-inequality
+ * lower bound of the distance from a vertex to the target over all the
+ * landmarks of a landmarks_t
+ * @v: vertex to estimate from
+ * @target: target vertex
+ * @param: landmark tables built for the searched graph (landmarks_t *)
+ * Return: the estimated cost, 0 if a vertex is not covered by the tables,
+ * e.g. when they were loaded for a smaller graph
+ */
+size_t heuristic_landmarks(vertex_t const *v, vertex_t const *target,
+	void const *param)
+{
+	landmarks_t const *lm = param;
+	int const *from = lm->from, *to = lm->to;
+	size_t l, best = 0;
+	long bound;
+
+	if (v->index >= lm->nb_vertices || target->index >= lm->nb_vertices)
+		return (0);
+	for (l = 0; l < lm->nb_landmarks; l++)
+	{
+		if (from[target->index] != INT_MAX && from[v->index] != INT_MAX)
+		{
+			bound = (long)from[target->index] - from[v->index];
+			if (bound > (long)best)
+				best = bound;
+		}
+		if (to[v->index] != INT_MAX && to[target->index] != INT_MAX)
+		{
+			bound = (long)to[v->index] - to[target->index];
+			if (bound > (long)best)
+				best = bound;
+		}
+		from += lm->nb_vertices, to += lm->nb_vertices;
+	}
+	return (best);
+}
@@ -0,0 +1,140 @@
+#include "pathfinding.h"
+
+/**
+ * landmarks_alloc - allocates empty ALT tables
+ * @nb_vertices: number of vertices of the graph
+ * @nb_landmarks: number of landmarks
+ * Return: pointer to the tables, NULL on failure or if the tables would
+ * not fit in memory
+ */
+landmarks_t *landmarks_alloc(size_t nb_vertices, size_t nb_landmarks)
+{
+	landmarks_t *lm;
+
+	if (nb_landmarks && nb_vertices >
+		((size_t)-1 / sizeof(*lm->from) - 1) / nb_landmarks)
+		return (NULL);
+	lm = calloc(1, sizeof(*lm));
+	if (!lm)
+		return (NULL);
+	lm->nb_vertices = nb_vertices, lm->nb_landmarks = nb_landmarks;
+	lm->landmarks = malloc((nb_landmarks + 1) * sizeof(*lm->landmarks));
+	lm->from = malloc((nb_landmarks * nb_vertices + 1) * sizeof(*lm->from));
+	lm->to = malloc((nb_landmarks * nb_vertices + 1) * sizeof(*lm->to));
+	if (!lm->landmarks || !lm->from || !lm->to)
+	{
+		landmarks_delete(lm);
+		return (NULL);
+	}
+	return (lm);
+}
+
+/**
+ * landmarks_delete - deallocates ALT tables
+ * @lm: pointer to the tables
+ */
+void landmarks_delete(landmarks_t *lm)
+{
+	if (!lm)
+		return;
+	free(lm->landmarks), free(lm->from), free(lm->to);
+	free(lm);
+}
+
+/**
+ * landmarks_fill - computes the distance tables of one landmark with a
+ * forward and a backward exhaustive Dijkstra search
+ * @lm: pointer to the tables
+ * @ctx: query context to search with
+ * @csr: snapshot of the graph
+ * @rev: transposed snapshot of the graph
+ * @l: number of the landmark, whose vertex is already chosen
+ * Return: 1 on success, 0 on failure
+ */
+int landmarks_fill(landmarks_t *lm, dijkstra_ctx_t *ctx,
+	csr_graph_t const *csr, csr_graph_t const *rev, size_t l)
+{
+	int *row;
+	size_t v;
+
+	row = lm->from + l * lm->nb_vertices;
+	if (csr_dijkstra_search(ctx, csr, lm->landmarks[l],
+		lm->nb_vertices) < 0)
+		return (0);
+	for (v = 0; v < lm->nb_vertices; v++)
+		row[v] = dijkstra_dist(ctx, v);
+	row = lm->to + l * lm->nb_vertices;
+	if (csr_dijkstra_search(ctx, rev, lm->landmarks[l],
+		lm->nb_vertices) < 0)
+		return (0);
+	for (v = 0; v < lm->nb_vertices; v++)
+		row[v] = dijkstra_dist(ctx, v);
+	return (1);
+}
+
+/**
+ * landmarks_pick - chooses the next landmark as the reachable vertex
+ * farthest from the landmarks chosen so far
+ * A landmark is at distance 0 from itself, so it is never picked twice
+ * unless every reachable vertex already is a landmark
+ * @lm: pointer to the tables, with @l landmarks already filled
+ * @l: number of landmarks already chosen
+ * @dists: distances from vertex 0, used when no landmark is chosen yet
+ * Return: vertex index of the new landmark
+ */
+size_t landmarks_pick(landmarks_t const *lm, size_t l, int const *dists)
+{
+	size_t v, i, best = 0;
+	int d, best_d = -1, *row;
+
+	for (v = 0; v < lm->nb_vertices; v++)
+	{
+		d = l ? INT_MAX : dists[v];
+		for (i = 0; i < l; i++)
+		{
+			row = lm->from + i * lm->nb_vertices;
+			if (row[v] < d)
+				d = row[v];
+		}
+		if (d != INT_MAX && d > best_d)
+			best_d = d, best = v;
+	}
+	return (best);
+}
+
+/**
+ * landmarks_create - picks landmarks in a graph and computes their
+ * distance tables, for use with heuristic_landmarks
+ * The first landmark is the vertex farthest from vertex 0, and each next
+ * one the vertex farthest from all the landmarks chosen before it
+ * @graph: pointer to the graph, which must not change afterwards
+ * @nb_landmarks: number of landmarks to pick
+ * Return: pointer to the tables, NULL on failure
+ */
+landmarks_t *landmarks_create(graph_t const *graph, size_t nb_landmarks)
+{
+	csr_graph_t *csr = graph_freeze(graph), *rev = NULL;
+	dijkstra_ctx_t *ctx = dijkstra_ctx_create();
+	landmarks_t *lm = NULL;
+	size_t l = 0;
+
+	if (csr && ctx && csr->nb_vertices && nb_landmarks)
+		rev = csr_transpose(csr);
+	if (rev)
+		lm = landmarks_alloc(csr->nb_vertices, nb_landmarks);
+	if (lm && csr_dijkstra_search(ctx, csr, 0, csr->nb_vertices) >= 0)
+	{
+		for (l = 0; l < csr->nb_vertices; l++)
+			lm->to[l] = dijkstra_dist(ctx, l);
+		for (l = 0; l < nb_landmarks; l++)
+		{
+			lm->landmarks[l] = landmarks_pick(lm, l, lm->to);
+			if (!landmarks_fill(lm, ctx, csr, rev, l))
+				break;
+		}
+	}
+	if (lm && l < nb_landmarks)
+		landmarks_delete(lm), lm = NULL;
+	csr_graph_delete(csr), csr_graph_delete(rev), dijkstra_ctx_delete(ctx);
+	return (lm);
+}
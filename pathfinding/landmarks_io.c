@@ -0,0 +1,71 @@
+#include "pathfinding.h"
+
+/**
+ * landmarks_save - writes ALT tables to a binary file
+ * The file holds LANDMARKS_MAGIC, the number of vertices and of
+ * landmarks, the landmark indices and the two distance tables, all in
+ * the byte order of the host
+ * @lm: pointer to the tables
+ * @path: path of the file to write
+ * Return: 1 on success, 0 on failure
+ */
+int landmarks_save(landmarks_t const *lm, char const *path)
+{
+	FILE *file;
+	size_t cells;
+	int ok;
+
+	if (!lm || !path)
+		return (0);
+	file = fopen(path, "wb");
+	if (!file)
+		return (0);
+	cells = lm->nb_landmarks * lm->nb_vertices;
+	ok = fwrite(LANDMARKS_MAGIC, 1, 4, file) == 4 &&
+		fwrite(&lm->nb_vertices, sizeof(size_t), 1, file) == 1 &&
+		fwrite(&lm->nb_landmarks, sizeof(size_t), 1, file) == 1 &&
+		fwrite(lm->landmarks, sizeof(size_t), lm->nb_landmarks, file) ==
+		lm->nb_landmarks &&
+		fwrite(lm->from, sizeof(int), cells, file) == cells &&
+		fwrite(lm->to, sizeof(int), cells, file) == cells;
+	if (fclose(file) != 0)
+		ok = 0;
+	return (ok);
+}
+
+/**
+ * landmarks_load - reads ALT tables written by landmarks_save
+ * Sizes too large to allocate and landmarks that are not vertices are
+ * rejected
+ * @path: path of the file to read
+ * Return: pointer to the tables, NULL on failure
+ */
+landmarks_t *landmarks_load(char const *path)
+{
+	FILE *file;
+	landmarks_t *lm = NULL;
+	size_t sizes[2], cells, l;
+	char magic[4];
+
+	file = path ? fopen(path, "rb") : NULL;
+	if (!file)
+		return (NULL);
+	if (fread(magic, 1, 4, file) == 4 &&
+		!memcmp(magic, LANDMARKS_MAGIC, 4) &&
+		fread(sizes, sizeof(size_t), 2, file) == 2)
+		lm = landmarks_alloc(sizes[0], sizes[1]);
+	if (lm)
+	{
+		cells = lm->nb_landmarks * lm->nb_vertices;
+		if (fread(lm->landmarks, sizeof(size_t), lm->nb_landmarks,
+			file) != lm->nb_landmarks ||
+			fread(lm->from, sizeof(int), cells, file) != cells ||
+			fread(lm->to, sizeof(int), cells, file) != cells)
+			landmarks_delete(lm), lm = NULL;
+	}
+	for (l = 0; lm && l < lm->nb_landmarks; l++)
+		if (lm->landmarks[l] >= lm->nb_vertices)
+			landmarks_delete(lm), lm = NULL;
+	fclose(file);
+	return (lm);
+}
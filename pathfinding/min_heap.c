@@ -0,0 +1,85 @@
+#include "pathfinding.h"
+
+/**
+ * min_heap_init - initializes an indexed min-heap
+ * @heap: pointer to the heap to initialize
+ * @capacity: number of distinct indices the heap can hold
+ * Return: 1 on success, 0 on failure
+ */
+int min_heap_init(min_heap_t *heap, size_t capacity)
+{
+	heap->size = 0;
+	heap->items = malloc(capacity * sizeof(*heap->items));
+	heap->pos = calloc(capacity, sizeof(*heap->pos));
+	heap->keys = malloc(capacity * sizeof(*heap->keys));
+	if (!heap->items || !heap->pos || !heap->keys)
+	{
+		min_heap_free(heap);
+		return (0);
+	}
+	return (1);
+}
+
+/**
+ * min_heap_free - deallocates the arrays of an indexed min-heap
+ * @heap: pointer to the heap
+ */
+void min_heap_free(min_heap_t *heap)
+{
+	free(heap->items), free(heap->pos), free(heap->keys);
+	heap->items = NULL, heap->pos = NULL, heap->keys = NULL;
+	heap->size = 0;
+}
+
+/**
+ * min_heap_contains - checks whether an index is in the heap
+ * A stale @pos entry never points back to its index, so @pos does not
+ * have to be cleared between two uses of the heap
+ * @heap: pointer to the heap
+ * @index: index to look for
+ * Return: 1 if @index is in the heap, 0 otherwise
+ */
+int min_heap_contains(min_heap_t const *heap, size_t index)
+{
+	return (heap->pos[index] < heap->size &&
+		heap->items[heap->pos[index]] == index);
+}
+
+/**
+ * min_heap_push - inserts an index, or changes its key if it is
+ * already in the heap
+ * @heap: pointer to the heap
+ * @index: index to insert
+ * @key: key of the index
+ */
+void min_heap_push(min_heap_t *heap, size_t index, size_t key)
+{
+	if (!min_heap_contains(heap, index))
+	{
+		heap->pos[index] = heap->size;
+		heap->items[heap->size++] = index;
+	}
+	heap->keys[index] = key;
+	min_heap_sift_up(heap, heap->pos[index]);
+	min_heap_sift_down(heap, heap->pos[index]);
+}
+
+/**
+ * min_heap_pop - removes the index with the lowest key
+ * Indices with equal keys are popped in increasing order
+ * @heap: pointer to the heap
+ * Return: the removed index
+ */
+size_t min_heap_pop(min_heap_t *heap)
+{
+	size_t index = heap->items[0];
+
+	heap->size--;
+	if (heap->size)
+	{
+		heap->items[0] = heap->items[heap->size];
+		heap->pos[heap->items[0]] = 0;
+		min_heap_sift_down(heap, 0);
+	}
+	return (index);
+}
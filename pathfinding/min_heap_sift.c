@@ -0,0 +1,71 @@
+#include "pathfinding.h"
+
+/**
+ * min_heap_less - compares two slots of an indexed min-heap
+ * Keys are compared first, then indices, so that the heap pops vertices
+ * in the same order as a linear scan for the minimum would
+ * @heap: pointer to the heap
+ * @a: first slot
+ * @b: second slot
+ * Return: 1 if slot @a comes before slot @b, 0 otherwise
+ */
+int min_heap_less(min_heap_t const *heap, size_t a, size_t b)
+{
+	size_t ia = heap->items[a], ib = heap->items[b];
+
+	if (heap->keys[ia] != heap->keys[ib])
+		return (heap->keys[ia] < heap->keys[ib]);
+	return (ia < ib);
+}
+
+/**
+ * min_heap_swap - swaps two slots of an indexed min-heap
+ * @heap: pointer to the heap
+ * @a: first slot
+ * @b: second slot
+ */
+void min_heap_swap(min_heap_t *heap, size_t a, size_t b)
+{
+	size_t tmp = heap->items[a];
+
+	heap->items[a] = heap->items[b];
+	heap->items[b] = tmp;
+	heap->pos[heap->items[a]] = a;
+	heap->pos[heap->items[b]] = b;
+}
+
+/**
+ * min_heap_sift_up - moves a slot up until its parent comes before it
+ * @heap: pointer to the heap
+ * @i: slot to move
+ */
+void min_heap_sift_up(min_heap_t *heap, size_t i)
+{
+	while (i > 0 && min_heap_less(heap, i, (i - 1) / 2))
+	{
+		min_heap_swap(heap, i, (i - 1) / 2);
+		i = (i - 1) / 2;
+	}
+}
+
+/**
+ * min_heap_sift_down - moves a slot down until it comes before
+ * both of its children
+ * @heap: pointer to the heap
+ * @i: slot to move
+ */
+void min_heap_sift_down(min_heap_t *heap, size_t i)
+{
+	size_t child;
+
+	while ((child = 2 * i + 1) < heap->size)
+	{
+		if (child + 1 < heap->size &&
+			min_heap_less(heap, child + 1, child))
+			child++;
+		if (!min_heap_less(heap, child, i))
+			break;
+		min_heap_swap(heap, i, child);
+		i = child;
+	}
+}
@@ -0,0 +1,80 @@
+#include "pathfinding.h"
+
+/**
+ * path_alloc - allocates an empty path
+ * @length: number of vertices the path can hold
+ * Return: pointer to the path, NULL on failure
+ */
+path_t *path_alloc(size_t length)
+{
+	path_t *path = calloc(1, sizeof(*path));
+
+	if (!path)
+		return (NULL);
+	path->vertices = malloc((length + 1) * sizeof(*path->vertices));
+	if (!path->vertices)
+	{
+		free(path);
+		return (NULL);
+	}
+	return (path);
+}
+
+/**
+ * path_delete - deallocates a path, leaving its vertices to the graph
+ * @path: pointer to the path
+ */
+void path_delete(path_t *path)
+{
+	if (!path)
+		return;
+	free(path->vertices);
+	free(path);
+}
+
+/**
+ * path_to_queue - converts a path to the queue of strdup'd names
+ * returned by dijkstra_graph and the other legacy searches
+ * @path: pointer to the path
+ * Return: path queue, NULL on failure
+ */
+queue_t *path_to_queue(path_t const *path)
+{
+	queue_t *queue;
+	size_t i;
+
+	if (!path)
+		return (NULL);
+	queue = queue_create();
+	if (!queue)
+		return (NULL);
+	for (i = 0; i < path->length; i++)
+		if (!path_queue_push(queue, path->vertices[i]->content, 0))
+			return (NULL);
+	return (queue);
+}
+
+/**
+ * dijkstra_path_vertices - builds the path found by the last query of a
+ * context without copying any name
+ * @ctx: pointer to the query context
+ * @target: pointer to the settled target vertex
+ * Return: pointer to the path from start to @target, NULL on failure
+ */
+path_t *dijkstra_path_vertices(dijkstra_ctx_t const *ctx,
+	vertex_t const *target)
+{
+	vertex_t const *v;
+	path_t *path;
+	size_t length = 0;
+
+	for (v = target; v; v = ctx->from[v->index])
+		length++;
+	path = path_alloc(length);
+	if (!path)
+		return (NULL);
+	path->length = length, path->cost = ctx->dists[target->index];
+	for (v = target; v; v = ctx->from[v->index])
+		path->vertices[--length] = v;
+	return (path);
+}
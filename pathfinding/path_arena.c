@@ -0,0 +1,68 @@
+#include "pathfinding.h"
+
+/**
+ * a_star_graph_arena_r - a_star_graph_r returning an arena queue
+ * @ctx: pointer to the query context of the calling thread
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+arena_queue_t *a_star_graph_arena_r(dijkstra_ctx_t *ctx,
+	graph_t const *graph, vertex_t const *start, vertex_t const *target)
+{
+	if (!ctx || !graph || !start || !target)
+		return (NULL);
+	if (a_star_search(ctx, graph, start, target) != 1)
+		return (NULL);
+	return (dijkstra_path_arena(ctx, target));
+}
+
+/**
+ * path_to_arena_queue - copies the names of the vertices of a path into
+ * an arena queue
+ * @path: pointer to the path
+ * Return: queue of the names of the vertices of @path, NULL on failure
+ */
+arena_queue_t *path_to_arena_queue(path_t const *path)
+{
+	arena_queue_t *queue;
+	size_t i;
+	char *str;
+
+	if (!path)
+		return (NULL);
+	queue = arena_queue_create();
+	if (!queue)
+		return (NULL);
+	for (i = 0; i < path->length; i++)
+	{
+		str = arena_strdup(&queue->arena, path->vertices[i]->content);
+		if (!str || !arena_queue_push_back(queue, str))
+		{
+			arena_queue_delete(queue);
+			return (NULL);
+		}
+	}
+	return (queue);
+}
+
+/**
+ * backtracking_graph_arena - backtracking_graph returning an arena queue,
+ * without tracing the search
+ * The branch is kept as a path of vertices while exploring, and only the
+ * names of the path found are copied into the arena
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue, NULL if there is none or on failure
+ */
+arena_queue_t *backtracking_graph_arena(graph_t const *graph,
+	vertex_t const *start, vertex_t const *target)
+{
+	path_t *path = backtracking_graph_path(graph, start, target);
+	arena_queue_t *queue = path_to_arena_queue(path);
+
+	path_delete(path);
+	return (queue);
+}
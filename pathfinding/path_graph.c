@@ -0,0 +1,96 @@
+#include "pathfinding.h"
+
+/**
+ * dijkstra_graph_path - dijkstra_graph_r returning the vertices of the
+ * path instead of copies of their names
+ * @ctx: pointer to the query context of the calling thread
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: pointer to the path, NULL if there is none or on failure
+ */
+path_t *dijkstra_graph_path(dijkstra_ctx_t *ctx, graph_t const *graph,
+	vertex_t const *start, vertex_t const *target)
+{
+	if (!ctx || !graph || !start || !target)
+		return (NULL);
+	if (dijkstra_search(ctx, graph, start, target) != 1)
+		return (NULL);
+	return (dijkstra_path_vertices(ctx, target));
+}
+
+/**
+ * a_star_graph_path - a_star_graph_r returning the vertices of the path
+ * instead of copies of their names
+ * Like a_star_graph, it finds no path from a vertex to itself
+ * @ctx: pointer to the query context of the calling thread
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: pointer to the path, NULL if there is none or on failure
+ */
+path_t *a_star_graph_path(dijkstra_ctx_t *ctx, graph_t const *graph,
+	vertex_t const *start, vertex_t const *target)
+{
+	if (!ctx || !graph || !start || !target || start == target)
+		return (NULL);
+	if (a_star_search(ctx, graph, start, target) != 1)
+		return (NULL);
+	return (dijkstra_path_vertices(ctx, target));
+}
+
+/**
+ * backtracking_fill_path - explores a graph depth first like graph_fill,
+ * keeping the vertices of the current branch in a path
+ * @path: path holding the branch leading to @current, with room for
+ *   every vertex of the graph
+ * @saw: whether each vertex has been visited
+ * @current: vertex being explored
+ * @target: vertex searched for
+ * Return: 1 if @target was found, @path then leading to it, 0 otherwise
+ */
+int backtracking_fill_path(path_t *path, char *saw, vertex_t const *current,
+	vertex_t const *target)
+{
+	edge_t const *e;
+	int cost = path->cost;
+
+	if (saw[current->index])
+		return (0);
+	path->vertices[path->length++] = current;
+	if (current == target)
+		return (1);
+	saw[current->index] = 1;
+	for (e = current->edges; e; e = e->next)
+	{
+		path->cost = cost + e->weight;
+		if (backtracking_fill_path(path, saw, e->dest, target))
+			return (1);
+	}
+	path->length--, path->cost = cost;
+	return (0);
+}
+
+/**
+ * backtracking_graph_path - backtracking_graph returning the vertices of
+ * the path instead of copies of their names, without tracing the search
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: pointer to the path, NULL if there is none or on failure
+ */
+path_t *backtracking_graph_path(graph_t const *graph,
+	vertex_t const *start, vertex_t const *target)
+{
+	path_t *path;
+	char *saw;
+
+	if (!graph || !start || !target)
+		return (NULL);
+	path = path_alloc(graph->nb_vertices);
+	saw = calloc(graph->nb_vertices + 1, 1);
+	if (!path || !saw || !backtracking_fill_path(path, saw, start, target))
+		path_delete(path), path = NULL;
+	free(saw);
+	return (path);
+}
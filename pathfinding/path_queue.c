@@ -0,0 +1,38 @@
+#include "pathfinding.h"
+
+/**
+ * path_queue_delete - frees a queue of strdup'd vertex names, names
+ * included
+ * @queue: pointer to the queue
+ */
+void path_queue_delete(queue_t *queue)
+{
+	char *str;
+
+	if (!queue)
+		return;
+	while ((str = dequeue(queue)))
+		free(str);
+	queue_delete(queue);
+}
+
+/**
+ * path_queue_push - pushes a copy of a vertex name on a path queue
+ * On failure the whole queue is freed, so the caller returns NULL
+ * without touching it again
+ * @queue: pointer to the queue
+ * @name: name to copy
+ * @front: whether to push at the front of @queue rather than its back
+ * Return: 1 on success, 0 on failure
+ */
+int path_queue_push(queue_t *queue, char const *name, int front)
+{
+	char *str = strdup(name);
+
+	if (str && (front ? queue_push_front(queue, str) :
+		queue_push_back(queue, str)))
+		return (1);
+	free(str);
+	path_queue_delete(queue);
+	return (0);
+}
@@ -7,7 +7,8 @@
 #include <stdio.h>
 #include <string.h>
 
-#define INT_MAX 2147483647
+#include <limits.h>
+#include <pthread.h>
 
 /**
 * struct point_s - Structure storing coordinates
@@ -23,6 +24,571 @@ typedef struct point_s
 
 } point_t;
 
+/**
+* enum heuristic_type_e - Built-in A* heuristics
+*
+* @HEURISTIC_EUCLIDEAN: Straight-line distance, for any-angle movement
+* @HEURISTIC_MANHATTAN: |dx| + |dy|, for 4-connected grids
+* @HEURISTIC_OCTILE: Diagonal moves costing sqrt(2) or the costs of an
+*   octile_cost_t, for 8-connected grids
+* @HEURISTIC_CHEBYSHEV: max(|dx|, |dy|), for 8-connected grids where
+*   diagonal moves cost the same as straight ones
+*/
+typedef enum heuristic_type_e
+{
+	HEURISTIC_EUCLIDEAN = 0,
+	HEURISTIC_MANHATTAN,
+	HEURISTIC_OCTILE,
+	HEURISTIC_CHEBYSHEV
+} heuristic_type_t;
+
+/**
+* struct octile_cost_s - Move costs of an 8-connected grid, given to
+* heuristic_octile, e.g. 10 and 14
+*
+* @straight: Cost of a horizontal or vertical move
+*
+* @diagonal: Cost of a diagonal move
+*/
+typedef struct octile_cost_s
+{
+	size_t straight;
+
+	size_t diagonal;
+
+} octile_cost_t;
+
+/*
+ * A* heuristic: lower bound of the cost from a vertex to the target.
+ * @param is the pointer given along with the heuristic; the built-in
+ * heuristics read it as a size_t const * holding the cost of one unit of
+ * distance, NULL meaning 1, except heuristic_octile which reads an
+ * octile_cost_t const *
+ */
+typedef size_t (*heuristic_t)(vertex_t const *v, vertex_t const *target,
+
+	void const *param);
+
+/**
+* struct min_heap_s - Indexed binary min-heap of vertex indices
+* Each index is stored at most once, so its key can be decreased in place
+*
+* @size: Number of indices in the heap
+* @items: Indices stored in the heap, @items[0] having the lowest key
+* @pos: Slot of each index in @items
+* @keys: Key of each index
+*/
+typedef struct min_heap_s
+{
+	size_t size;
+
+	size_t *items;
+
+	size_t *pos;
+
+	size_t *keys;
+
+} min_heap_t;
+
+/**
+* struct csr_graph_s - Frozen compressed sparse row form of a graph_t
+* The edges of the vertex of index i are the entries @offsets[i] to
+* @offsets[i + 1] - 1 of @dests and @weights, in the order of its edge list
+*
+* @nb_vertices: Number of vertices
+* @nb_edges: Number of edges
+* @offsets: First edge of each vertex, followed by @nb_edges
+* @dests: Index of the destination vertex of each edge
+* @weights: Weight of each edge
+* @x: X coordinate of each vertex
+* @y: Y coordinate of each vertex
+* @vertices: Vertex of each index in the graph the snapshot was built from
+*/
+typedef struct csr_graph_s
+{
+	size_t nb_vertices;
+
+	size_t nb_edges;
+
+	size_t *offsets;
+
+	size_t *dests;
+
+	int *weights;
+
+	int *x;
+
+	int *y;
+
+	vertex_t **vertices;
+
+} csr_graph_t;
+
+/**
+* struct landmarks_s - ALT (A*, Landmarks, Triangle inequality) tables
+* For a landmark L, d(L, t) - d(L, v) and d(v, L) - d(t, L) are both lower
+* bounds of d(v, t), and the largest bound over all landmarks is used as
+* A* heuristic (see heuristic_landmarks)
+*
+* @nb_vertices: Number of vertices of the graph the tables were built for
+* @nb_landmarks: Number of landmarks
+* @landmarks: Vertex index of each landmark
+* @from: @from[l * @nb_vertices + v] is the distance from landmark l to
+*   vertex v, INT_MAX if v is unreachable
+* @to: @to[l * @nb_vertices + v] is the distance from vertex v to
+*   landmark l, INT_MAX if the landmark is unreachable
+*/
+typedef struct landmarks_s
+{
+	size_t nb_vertices;
+
+	size_t nb_landmarks;
+
+	size_t *landmarks;
+
+	int *from;
+
+	int *to;
+
+} landmarks_t;
+
+#define LANDMARKS_MAGIC "ALT1"
+
+/**
+* struct dijkstra_ctx_s - Scratch space of a Dijkstra query
+* Each thread owns its own context and reuses it between queries.
+* An entry of @dists or @from only belongs to the current query when its
+* entry in @stamps equals @generation, so nothing has to be cleared
+* before a new query starts
+*
+* @capacity: Number of vertices the buffers can hold
+* @generation: Stamp of the current query
+* @stamps: Stamp of the query that last reached each vertex
+* @dists: Distance of each vertex from the start vertex
+* @from: Vertex each vertex is reached from
+* @verts: Vertex of each index in the graph searched
+* @heap: Reached vertices that are not settled yet
+* @trace: Whether to print each vertex as it is settled
+* @heuristic: Heuristic used by A* searches, NULL for h()
+* @heuristic_param: Parameter handed to @heuristic
+* @nb_expanded: Number of vertices settled by the last query
+*/
+typedef struct dijkstra_ctx_s
+{
+	size_t capacity;
+
+	unsigned int generation;
+
+	unsigned int *stamps;
+
+	int *dists;
+
+	vertex_t **from;
+
+	vertex_t **verts;
+
+	min_heap_t heap;
+
+	int trace;
+
+	heuristic_t heuristic;
+
+	void const *heuristic_param;
+
+	size_t nb_expanded;
+
+} dijkstra_ctx_t;
+
+/**
+* struct sssp_s - Result of a single-source Dijkstra search
+*
+* @nb_vertices: Number of vertices
+* @source: Index of the start vertex
+* @dists: Distance of each vertex from the start vertex, INT_MAX if it
+*   was not settled
+* @preds: Index of the vertex each vertex is reached from, SSSP_NO_PRED
+*   for the start vertex and for vertices that were not settled
+* @vertices: Vertex of each index in the graph
+*/
+typedef struct sssp_s
+{
+	size_t nb_vertices;
+
+	size_t source;
+
+	int *dists;
+
+	size_t *preds;
+
+	vertex_t **vertices;
+
+} sssp_t;
+
+#define SSSP_NO_PRED ((size_t)-1)
+
+/**
+* struct dstep_bucket_s - Growable array of vertex indices
+*
+* @items: Vertex indices
+* @size: Number of indices
+* @capacity: Number of indices @items can hold
+*/
+typedef struct dstep_bucket_s
+{
+	size_t *items;
+
+	size_t size;
+
+	size_t capacity;
+
+} dstep_bucket_t;
+
+/**
+* struct dstep_worker_s - Per-thread state of a delta-stepping search
+*
+* @ds: Shared state of the search
+* @id: Number of the thread, 0 being the calling thread
+* @thread: Handle of the thread
+* @buckets: Vertices this thread queued, in @ds->nb_buckets circular
+*   buckets of width @ds->delta
+* @frontier: Vertices of the current bucket being relaxed
+* @settled: Vertices of the current bucket whose heavy edges are left
+* @failed: Whether an allocation of this thread failed
+*/
+typedef struct dstep_worker_s
+{
+	struct dstep_s *ds;
+
+	size_t id;
+
+	pthread_t thread;
+
+	dstep_bucket_t *buckets;
+
+	dstep_bucket_t frontier;
+
+	dstep_bucket_t settled;
+
+	int failed;
+
+} dstep_worker_t;
+
+/**
+* struct dstep_s - Shared state of a delta-stepping search
+* Vertices are queued in buckets of distances of width @delta. The
+* lowest bucket is emptied by relaxing light edges (weight <= @delta)
+* until no vertex falls back in it, then the heavy edges of the vertices
+* it held are relaxed once. Each thread queues the vertices whose
+* distance it lowered in its own buckets
+*
+* @csr: Snapshot being searched
+* @rev: Transposed snapshot, used to pick predecessors
+* @res: Result, whose distances are lowered atomically during the search
+* @relaxed: Distance each vertex last had its light edges relaxed at
+* @marks: Bucket (plus one) each vertex was last added to @settled for
+* @delta: Width of a bucket
+* @nb_buckets: Number of circular buckets, enough for the heaviest edge
+* @bucket: Current bucket
+* @done: Whether every bucket is empty
+* @again: Whether the current bucket got vertices back
+* @nb_threads: Number of threads taking part in the search
+* @workers: Per-thread state, @nb_threads entries
+* @barrier: Barrier separating two phases
+* @lock: Mutex protecting @started
+* @start: Condition signaled once every thread is created
+* @started: Whether the threads may start
+*/
+typedef struct dstep_s
+{
+	csr_graph_t const *csr;
+
+	csr_graph_t const *rev;
+
+	sssp_t *res;
+
+	int *relaxed;
+
+	size_t *marks;
+
+	int delta;
+
+	size_t nb_buckets;
+
+	size_t bucket;
+
+	int done;
+
+	int again;
+
+	size_t nb_threads;
+
+	dstep_worker_t *workers;
+
+	pthread_barrier_t barrier;
+
+	pthread_mutex_t lock;
+
+	pthread_cond_t start;
+
+	int started;
+
+} dstep_t;
+
+/**
+* struct arena_block_s - Header of a block of an arena
+* The memory handed out follows the header, ARENA_HEADER bytes after it
+*
+* @next: Previously filled block
+* @size: Number of bytes after the header
+* @used: Number of those bytes handed out
+*/
+typedef struct arena_block_s
+{
+	struct arena_block_s *next;
+
+	size_t size;
+
+	size_t used;
+
+} arena_block_t;
+
+#define ARENA_ALIGN (2 * sizeof(void *))
+#define ARENA_ROUND(n) (((n) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+#define ARENA_HEADER ARENA_ROUND(sizeof(arena_block_t))
+#define ARENA_BLOCK_SIZE 4096
+
+/**
+* struct arena_s - Bump allocator whose memory is freed all at once
+*
+* @blocks: Block being filled, linked to the blocks filled before it
+*/
+typedef struct arena_s
+{
+	arena_block_t *blocks;
+
+} arena_t;
+
+/**
+* struct arena_queue_s - Queue whose nodes and data live in an arena
+* @queue comes first, so &@queue can be read like any other queue_t, but
+* the queue must be emptied with arena_queue_pop and freed with
+* arena_queue_delete, never with dequeue or queue_delete
+*
+* @queue: The queue itself
+* @arena: Arena holding the nodes and the data
+*/
+typedef struct arena_queue_s
+{
+	queue_t queue;
+
+	arena_t arena;
+
+} arena_queue_t;
+
+/**
+* struct path_s - Path pointing into the graph it was found in
+* The vertices and their names belong to the graph, so the path is only
+* valid as long as the graph is
+*
+* @length: Number of vertices
+* @cost: Sum of the weights of the edges followed
+* @vertices: Vertices from start to target
+*/
+typedef struct path_s
+{
+	size_t length;
+
+	int cost;
+
+	vertex_t const **vertices;
+
+} path_t;
+
+/**
+* struct grid_s - Read-only view of a map of cells, '0' being walkable
+* The cells are read in place, either from a flat row-major buffer or
+* from an array of rows such as the map of backtracking_array
+*
+* @rows: Number of rows
+* @cols: Number of columns
+* @cells: Flat buffer, NULL when @lines is used
+* @stride: Number of bytes from one row of @cells to the next
+* @lines: Array of @rows rows of @cols cells, used when @cells is NULL
+*/
+typedef struct grid_s
+{
+	int rows;
+
+	int cols;
+
+	char const *cells;
+
+	size_t stride;
+
+	char * const *lines;
+
+} grid_t;
+
+/**
+* struct grid_path_s - Path on a grid
+*
+* @length: Number of points, the path taking @length - 1 steps
+* @points: Points from start to target
+*/
+typedef struct grid_path_s
+{
+	size_t length;
+
+	point_t *points;
+
+} grid_path_t;
+
+/**
+* struct grid_search_s - Scratch space of a grid search
+*
+* @grid: Grid being searched
+* @nb_cells: Number of cells of @grid
+* @visited: Bitset of the cells already expanded (A*) or queued (BFS)
+* @dirs: Move that reached each visited cell, see GRID_DX and GRID_DY
+* @queue: Cells queued by a breadth-first search
+* @g: Number of steps to each cell reached by an A* search
+* @heap: Cells reached by an A* search and not expanded yet
+*/
+typedef struct grid_search_s
+{
+	grid_t const *grid;
+
+	size_t nb_cells;
+
+	unsigned long *visited;
+
+	unsigned char *dirs;
+
+	size_t *queue;
+
+	int *g;
+
+	min_heap_t heap;
+
+} grid_search_t;
+
+#define GRID_WORD_BITS (sizeof(unsigned long) * CHAR_BIT)
+#define GRID_DX(d) ((d) == 0 ? 1 : (d) == 2 ? -1 : 0)
+#define GRID_DY(d) ((d) == 1 ? 1 : (d) == 3 ? -1 : 0)
+
+/**
+* struct ch_edge_s - Edge of a contraction hierarchy
+*
+* @dest: Index of the vertex at the other end of the edge
+* @weight: Weight of the edge
+* @middle: Vertex a shortcut bypasses, CH_NO_MIDDLE for an edge of the
+*   original graph
+*/
+typedef struct ch_edge_s
+{
+	size_t dest;
+
+	int weight;
+
+	size_t middle;
+
+} ch_edge_t;
+
+#define CH_NO_MIDDLE ((size_t)-1)
+#define CH_MAGIC "CH02"
+#define CH_WITNESS_LIMIT 256
+#define CH_PRIORITY_BIAS ((size_t)INT_MAX)
+
+/**
+* struct ch_list_s - Growable edge list of a vertex being contracted
+*
+* @edges: Edges, at most one per neighbor
+* @size: Number of edges
+* @capacity: Number of edges @edges can hold
+*/
+typedef struct ch_list_s
+{
+	ch_edge_t *edges;
+
+	size_t size;
+
+	size_t capacity;
+
+} ch_list_t;
+
+/**
+* struct ch_build_s - State of the contraction of a graph
+* Once a vertex is contracted, it is removed from the lists of the
+* vertices that are not, but keeps its own lists, which then hold all of
+* its edges towards vertices contracted after it
+*
+* @nb_vertices: Number of vertices
+* @nb_ranked: Number of vertices contracted so far
+* @out: Outgoing edges of each vertex
+* @in: Incoming edges of each vertex, @dest being their source
+* @rank: Contraction order of each contracted vertex
+* @deleted: Number of contracted neighbors of each vertex
+* @order: Vertices not contracted yet, keyed on their priority
+* @ctx: Scratch space of the witness searches
+*/
+typedef struct ch_build_s
+{
+	size_t nb_vertices;
+
+	size_t nb_ranked;
+
+	ch_list_t *out;
+
+	ch_list_t *in;
+
+	size_t *rank;
+
+	size_t *deleted;
+
+	min_heap_t order;
+
+	dijkstra_ctx_t *ctx;
+
+} ch_build_t;
+
+/**
+* struct ch_graph_s - Contraction hierarchy of a graph
+* Every shortest path is made of @up edges followed by reversed @down
+* edges, so a query only ever searches towards higher ranks
+*
+* @nb_vertices: Number of vertices
+* @nb_up: Number of upward edges
+* @nb_down: Number of downward edges
+* @rank: Contraction order of each vertex
+* @up_offsets: First entry of @up of each vertex, followed by @nb_up
+* @up: Edges from each vertex to higher ranked vertices
+* @down_offsets: First entry of @down of each vertex, followed by @nb_down
+* @down: Edges from higher ranked vertices to each vertex, @dest being
+*   their source
+* @vertices: Vertex of each index in the graph
+*/
+typedef struct ch_graph_s
+{
+	size_t nb_vertices;
+
+	size_t nb_up;
+
+	size_t nb_down;
+
+	size_t *rank;
+
+	size_t *up_offsets;
+
+	ch_edge_t *up;
+
+	size_t *down_offsets;
+
+	ch_edge_t *down;
+
+	vertex_t **vertices;
+
+} ch_graph_t;
+
 queue_t *backtracking_array(char **map, int rows, int cols,
 
 	point_t const *start, point_t const *target);
@@ -38,4 +604,386 @@ queue_t *dijkstra_graph(graph_t *graph, vertex_t const *start,
 
 	vertex_t const *target);
 
+queue_t *dijkstra_path(dijkstra_ctx_t const *ctx, vertex_t const *target);
+
+queue_t *dijkstra_graph_r(dijkstra_ctx_t *ctx, graph_t const *graph,
+
+	vertex_t const *start, vertex_t const *target);
+
+dijkstra_ctx_t *dijkstra_ctx_create(void);
+
+void dijkstra_ctx_delete(dijkstra_ctx_t *ctx);
+
+int dijkstra_ctx_reserve(dijkstra_ctx_t *ctx, size_t capacity);
+
+int dijkstra_ctx_begin(dijkstra_ctx_t *ctx, size_t nb_vertices);
+
+int dijkstra_ctx_prepare(dijkstra_ctx_t *ctx, graph_t const *graph);
+
+int dijkstra_dist(dijkstra_ctx_t const *ctx, size_t i);
+
+int dijkstra_settled(dijkstra_ctx_t const *ctx, size_t i);
+
+void dijkstra_reach(dijkstra_ctx_t *ctx, size_t i, int dist,
+
+	vertex_t *from);
+
+void dijkstra_relax(dijkstra_ctx_t *ctx, size_t j);
+
+int dijkstra_search(dijkstra_ctx_t *ctx, graph_t const *graph,
+
+	vertex_t const *start, vertex_t const *target);
+
+int bidir_top(dijkstra_ctx_t const *ctx);
+
+int bidir_best(dijkstra_ctx_t const *fwd, dijkstra_ctx_t const *bwd,
+
+	size_t meet);
+
+int min_heap_init(min_heap_t *heap, size_t capacity);
+
+void min_heap_free(min_heap_t *heap);
+
+int min_heap_contains(min_heap_t const *heap, size_t index);
+
+void min_heap_push(min_heap_t *heap, size_t index, size_t key);
+
+size_t min_heap_pop(min_heap_t *heap);
+
+int min_heap_less(min_heap_t const *heap, size_t a, size_t b);
+
+void min_heap_swap(min_heap_t *heap, size_t a, size_t b);
+
+void min_heap_sift_up(min_heap_t *heap, size_t i);
+
+void min_heap_sift_down(min_heap_t *heap, size_t i);
+
+queue_t *a_star_graph(graph_t *graph, vertex_t const *start,
+
+	vertex_t const *target);
+
+size_t a_star_estimate(dijkstra_ctx_t const *ctx, vertex_t const *v,
+
+	vertex_t const *target);
+
+void a_star_relax(dijkstra_ctx_t *ctx, size_t j, vertex_t const *target);
+
+int a_star_search(dijkstra_ctx_t *ctx, graph_t const *graph,
+
+	vertex_t const *start, vertex_t const *target);
+
+queue_t *a_star_graph_r(dijkstra_ctx_t *ctx, graph_t const *graph,
+
+	vertex_t const *start, vertex_t const *target);
+
+size_t h(int x1, int y1, int x2, int y2);
+
+size_t heuristic_euclidean(vertex_t const *v, vertex_t const *target,
+
+	void const *param);
+
+size_t heuristic_manhattan(vertex_t const *v, vertex_t const *target,
+
+	void const *param);
+
+size_t heuristic_octile(vertex_t const *v, vertex_t const *target,
+
+	void const *param);
+
+size_t heuristic_chebyshev(vertex_t const *v, vertex_t const *target,
+
+	void const *param);
+
+heuristic_t heuristic_get(heuristic_type_t type);
+
+size_t heuristic_landmarks(vertex_t const *v, vertex_t const *target,
+
+	void const *param);
+
+landmarks_t *landmarks_alloc(size_t nb_vertices, size_t nb_landmarks);
+
+void landmarks_delete(landmarks_t *lm);
+
+int landmarks_fill(landmarks_t *lm, dijkstra_ctx_t *ctx,
+
+	csr_graph_t const *csr, csr_graph_t const *rev, size_t l);
+
+size_t landmarks_pick(landmarks_t const *lm, size_t l, int const *dists);
+
+landmarks_t *landmarks_create(graph_t const *graph, size_t nb_landmarks);
+
+int landmarks_save(landmarks_t const *lm, char const *path);
+
+landmarks_t *landmarks_load(char const *path);
+
+csr_graph_t *csr_graph_alloc(size_t nb_vertices, size_t nb_edges);
+
+csr_graph_t *graph_freeze(graph_t const *graph);
+
+csr_graph_t *csr_transpose(csr_graph_t const *csr);
+
+void csr_graph_delete(csr_graph_t *csr);
+
+void csr_dijkstra_relax(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+
+	size_t j);
+
+int csr_dijkstra_search(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+
+	size_t start, size_t target);
+
+queue_t *csr_dijkstra_graph(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+
+	vertex_t const *start, vertex_t const *target);
+
+size_t csr_a_star_estimate(dijkstra_ctx_t const *ctx,
+
+	csr_graph_t const *csr, size_t k, size_t target);
+
+void csr_a_star_relax(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+
+	size_t j, size_t target);
+
+int csr_a_star_search(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+
+	size_t start, size_t target);
+
+queue_t *csr_a_star_graph(dijkstra_ctx_t *ctx, csr_graph_t const *csr,
+
+	vertex_t const *start, vertex_t const *target);
+
+int ch_list_add(ch_list_t *list, size_t dest, int weight, size_t middle);
+
+void ch_list_remove(ch_list_t *list, size_t dest);
+
+ch_build_t *ch_build_create(csr_graph_t const *csr);
+
+void ch_build_delete(ch_build_t *b);
+
+void ch_witness(ch_build_t *b, size_t u, size_t v, int max);
+
+int ch_shortcuts(ch_build_t *b, size_t v, int apply);
+
+size_t ch_priority(ch_build_t *b, size_t v);
+
+int ch_contract(ch_build_t *b, size_t v);
+
+ch_graph_t *ch_alloc(size_t nb_vertices, size_t nb_up, size_t nb_down);
+
+void ch_delete(ch_graph_t *ch);
+
+ch_graph_t *ch_finalize(ch_build_t const *b, csr_graph_t const *csr);
+
+ch_graph_t *ch_create(graph_t const *graph);
+
+int ch_write_edges(FILE *file, ch_edge_t const *edges, size_t nb_edges);
+
+int ch_read_edges(FILE *file, ch_edge_t *edges, size_t nb_edges);
+
+int ch_check_edges(ch_graph_t const *ch, ch_edge_t const *edges,
+
+	size_t nb_edges, size_t v);
+
+int ch_check(ch_graph_t const *ch);
+
+int ch_save(ch_graph_t const *ch, char const *path);
+
+ch_graph_t *ch_load(char const *path, graph_t const *graph);
+
+void ch_step(dijkstra_ctx_t *ctx, dijkstra_ctx_t const *other,
+
+	ch_graph_t const *ch, int up, size_t *meet);
+
+size_t ch_search(dijkstra_ctx_t *fwd, dijkstra_ctx_t *bwd,
+
+	ch_graph_t const *ch, size_t start, size_t target);
+
+ch_edge_t const *ch_find_edge(ch_graph_t const *ch, size_t a, size_t b);
+
+int ch_unpack(ch_graph_t const *ch, size_t a, size_t b, queue_t *path);
+
+queue_t *ch_path(dijkstra_ctx_t const *fwd, dijkstra_ctx_t const *bwd,
+
+	ch_graph_t const *ch, size_t meet);
+
+queue_t *ch_graph_r(dijkstra_ctx_t *fwd, dijkstra_ctx_t *bwd,
+
+	ch_graph_t const *ch, vertex_t const *start, vertex_t const *target);
+
+queue_t *ch_graph(ch_graph_t const *ch, vertex_t const *start,
+
+	vertex_t const *target);
+
+void bidijkstra_step(dijkstra_ctx_t *ctx, dijkstra_ctx_t const *other,
+
+	csr_graph_t const *csr, size_t *meet);
+
+size_t bidijkstra_search(dijkstra_ctx_t *fwd, dijkstra_ctx_t *bwd,
+
+	csr_graph_t const *csr, csr_graph_t const *rev, size_t start,
+
+	size_t target);
+
+queue_t *bidijkstra_graph_r(dijkstra_ctx_t *fwd, dijkstra_ctx_t *bwd,
+
+	csr_graph_t const *csr, csr_graph_t const *rev,
+
+	vertex_t const *start, vertex_t const *target);
+
+queue_t *bidijkstra_graph(graph_t *graph, vertex_t const *start,
+
+	vertex_t const *target);
+
+sssp_t *sssp_alloc(size_t nb_vertices);
+
+void sssp_delete(sssp_t *res);
+
+int sssp_search(dijkstra_ctx_t *ctx, graph_t const *graph,
+
+	vertex_t const *start, vertex_t const * const *targets,
+
+	size_t nb_targets);
+
+sssp_t *dijkstra_one_to_many_r(dijkstra_ctx_t *ctx, graph_t const *graph,
+
+	vertex_t const *start, vertex_t const * const *targets,
+
+	size_t nb_targets);
+
+sssp_t *dijkstra_one_to_many(graph_t *graph, vertex_t const *start,
+
+	vertex_t const * const *targets, size_t nb_targets);
+
+int sssp_dist(sssp_t const *res, vertex_t const *target);
+
+queue_t *sssp_path(sssp_t const *res, vertex_t const *target);
+
+int dstep_push(dstep_bucket_t *bucket, size_t v);
+
+void dstep_relax(dstep_worker_t *worker, size_t v, int dist);
+
+void dstep_light(dstep_worker_t *worker);
+
+void dstep_heavy(dstep_worker_t *worker);
+
+void *dstep_worker(void *arg);
+
+int dstep_pending(dstep_t *ds, size_t bucket);
+
+void dstep_next_bucket(dstep_t *ds);
+
+void dstep_preds(dstep_worker_t *worker);
+
+int dstep_zero_preds(dstep_t *ds);
+
+dstep_t *dstep_create(csr_graph_t const *csr, csr_graph_t const *rev,
+
+	int delta, size_t nb_threads);
+
+void dstep_delete(dstep_t *ds);
+
+void dstep_launch(dstep_t *ds);
+
+sssp_t *delta_stepping(csr_graph_t const *csr, csr_graph_t const *rev,
+
+	size_t source, int delta, size_t nb_threads);
+
+sssp_t *delta_stepping_graph(graph_t *graph, vertex_t const *start,
+
+	int delta, size_t nb_threads);
+
+void *arena_alloc(arena_t *arena, size_t size);
+
+char *arena_strdup(arena_t *arena, char const *str);
+
+void arena_free(arena_t *arena);
+
+arena_queue_t *arena_queue_create(void);
+
+queue_node_t *arena_queue_push_back(arena_queue_t *aq, void *ptr);
+
+queue_node_t *arena_queue_push_front(arena_queue_t *aq, void *ptr);
+
+void *arena_queue_pop(arena_queue_t *aq);
+
+void arena_queue_delete(arena_queue_t *aq);
+
+arena_queue_t *dijkstra_path_arena(dijkstra_ctx_t const *ctx,
+
+	vertex_t const *target);
+
+arena_queue_t *dijkstra_graph_arena_r(dijkstra_ctx_t *ctx,
+
+	graph_t const *graph, vertex_t const *start, vertex_t const *target);
+
+path_t *path_alloc(size_t length);
+
+void path_delete(path_t *path);
+
+queue_t *path_to_queue(path_t const *path);
+
+void path_queue_delete(queue_t *queue);
+
+int path_queue_push(queue_t *queue, char const *name, int front);
+
+path_t *dijkstra_path_vertices(dijkstra_ctx_t const *ctx,
+
+	vertex_t const *target);
+
+path_t *dijkstra_graph_path(dijkstra_ctx_t *ctx, graph_t const *graph,
+
+	vertex_t const *start, vertex_t const *target);
+
+path_t *a_star_graph_path(dijkstra_ctx_t *ctx, graph_t const *graph,
+
+	vertex_t const *start, vertex_t const *target);
+
+int backtracking_fill_path(path_t *path, char *saw, vertex_t const *current,
+
+	vertex_t const *target);
+
+path_t *backtracking_graph_path(graph_t const *graph,
+
+	vertex_t const *start, vertex_t const *target);
+
+arena_queue_t *a_star_graph_arena_r(dijkstra_ctx_t *ctx,
+
+	graph_t const *graph, vertex_t const *start, vertex_t const *target);
+
+arena_queue_t *path_to_arena_queue(path_t const *path);
+
+arena_queue_t *backtracking_graph_arena(graph_t const *graph,
+
+	vertex_t const *start, vertex_t const *target);
+
+void grid_init_rows(grid_t *grid, char * const *map, int rows, int cols);
+
+void grid_init_flat(grid_t *grid, char const *cells, int rows, int cols);
+
+int grid_open(grid_t const *grid, int x, int y);
+
+void grid_path_delete(grid_path_t *path);
+
+int grid_search_init(grid_search_t *search, grid_t const *grid, int a_star);
+
+void grid_search_free(grid_search_t *search);
+
+int grid_visit(grid_search_t *search, size_t cell);
+
+grid_path_t *grid_path_build(grid_search_t const *search,
+
+	point_t const *start, point_t const *target);
+
+grid_path_t *grid_bfs(grid_t const *grid, point_t const *start,
+
+	point_t const *target);
+
+void grid_a_star_expand(grid_search_t *search, size_t cell,
+
+	point_t const *target);
+
+grid_path_t *grid_a_star(grid_t const *grid, point_t const *start,
+
+	point_t const *target);
+
 #endif /*PATHFINDING_H*/
@@ -0,0 +1,140 @@
+#include "pathfinding.h"
+
+/**
+ * sssp_alloc - allocates the result of a single-source search
+ * @nb_vertices: number of vertices of the graph
+ * Return: pointer to the result, NULL on failure
+ */
+sssp_t *sssp_alloc(size_t nb_vertices)
+{
+	sssp_t *res = calloc(1, sizeof(*res));
+
+	if (!res)
+		return (NULL);
+	res->nb_vertices = nb_vertices;
+	res->dists = malloc((nb_vertices + 1) * sizeof(*res->dists));
+	res->preds = malloc((nb_vertices + 1) * sizeof(*res->preds));
+	res->vertices = malloc((nb_vertices + 1) * sizeof(*res->vertices));
+	if (!res->dists || !res->preds || !res->vertices)
+	{
+		sssp_delete(res);
+		return (NULL);
+	}
+	return (res);
+}
+
+/**
+ * sssp_delete - deallocates the result of a single-source search
+ * @res: pointer to the result
+ */
+void sssp_delete(sssp_t *res)
+{
+	if (!res)
+		return;
+	free(res->dists), free(res->preds), free(res->vertices);
+	free(res);
+}
+
+/**
+ * sssp_search - settles vertices from a start vertex until every target
+ * vertex is settled
+ * @ctx: pointer to the query context
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @targets: target vertices, duplicates allowed
+ * @nb_targets: number of target vertices, 0 to settle every reachable
+ *   vertex
+ * Return: number of targets left unsettled, -1 on failure
+ */
+int sssp_search(dijkstra_ctx_t *ctx, graph_t const *graph,
+	vertex_t const *start, vertex_t const * const *targets,
+	size_t nb_targets)
+{
+	char *wanted = NULL;
+	size_t i, j;
+	int left = 0;
+
+	if (nb_targets)
+	{
+		wanted = calloc(graph->nb_vertices + 1, 1);
+		if (!wanted)
+			return (-1);
+		for (i = 0; i < nb_targets; i++)
+			if (!wanted[targets[i]->index]++)
+				left++;
+	}
+	if (!dijkstra_ctx_prepare(ctx, graph))
+		return (free(wanted), -1);
+	dijkstra_reach(ctx, start->index, 0, NULL);
+	while (ctx->heap.size && (!wanted || left))
+	{
+		j = min_heap_pop(&ctx->heap), ctx->nb_expanded++;
+		dijkstra_relax(ctx, j);
+		if (wanted && wanted[j])
+			left--;
+	}
+	free(wanted);
+	return (left);
+}
+
+/**
+ * dijkstra_one_to_many_r - reentrant version of dijkstra_one_to_many
+ * @ctx: pointer to the query context of the calling thread
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @targets: target vertices
+ * @nb_targets: number of target vertices, 0 to settle every reachable
+ *   vertex
+ * Return: pointer to the result, NULL on failure
+ */
+sssp_t *dijkstra_one_to_many_r(dijkstra_ctx_t *ctx, graph_t const *graph,
+	vertex_t const *start, vertex_t const * const *targets,
+	size_t nb_targets)
+{
+	sssp_t *res;
+	size_t i;
+
+	if (!ctx || !graph || !start || (nb_targets && !targets))
+		return (NULL);
+	res = sssp_alloc(graph->nb_vertices);
+	if (!res || sssp_search(ctx, graph, start, targets, nb_targets) < 0)
+		return (sssp_delete(res), NULL);
+	res->source = start->index;
+	memcpy(res->vertices, ctx->verts,
+		graph->nb_vertices * sizeof(*res->vertices));
+	for (i = 0; i < graph->nb_vertices; i++)
+	{
+		res->dists[i] = INT_MAX, res->preds[i] = SSSP_NO_PRED;
+		if (!dijkstra_settled(ctx, i))
+			continue;
+		res->dists[i] = ctx->dists[i];
+		if (ctx->from[i])
+			res->preds[i] = ctx->from[i]->index;
+	}
+	return (res);
+}
+
+/**
+ * dijkstra_one_to_many - runs one Dijkstra search from a start vertex
+ * until every target vertex is settled, or until every reachable vertex
+ * is settled when there are no targets
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @targets: target vertices
+ * @nb_targets: number of target vertices, 0 to settle every reachable
+ *   vertex
+ * Return: distances and predecessors of all the settled vertices, NULL on
+ *   failure
+ */
+sssp_t *dijkstra_one_to_many(graph_t *graph, vertex_t const *start,
+	vertex_t const * const *targets, size_t nb_targets)
+{
+	dijkstra_ctx_t *ctx = dijkstra_ctx_create();
+	sssp_t *res = NULL;
+
+	if (ctx)
+		res = dijkstra_one_to_many_r(ctx, graph, start, targets,
+			nb_targets);
+	dijkstra_ctx_delete(ctx);
+	return (res);
+}
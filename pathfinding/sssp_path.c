@@ -0,0 +1,41 @@
+#include "pathfinding.h"
+
+/**
+ * sssp_dist - gets the distance of a vertex in a single-source result
+ * @res: pointer to the result
+ * @target: pointer to the vertex
+ * Return: the distance, INT_MAX if @target was not settled
+ */
+int sssp_dist(sssp_t const *res, vertex_t const *target)
+{
+	if (!res || !target || target->index >= res->nb_vertices)
+		return (INT_MAX);
+	return (res->dists[target->index]);
+}
+
+/**
+ * sssp_path - builds the path to a vertex from a single-source result
+ * @res: pointer to the result
+ * @target: pointer to target vertex
+ * Return: queue of the names of the vertices from the start vertex to
+ *   @target, the same as dijkstra_graph gives, or NULL if @target was not
+ *   settled or on failure
+ */
+queue_t *sssp_path(sssp_t const *res, vertex_t const *target)
+{
+	queue_t *path;
+	size_t i;
+
+	if (sssp_dist(res, target) == INT_MAX)
+		return (NULL);
+	path = queue_create();
+	if (!path)
+		return (NULL);
+	for (i = target->index; res->preds[i] != SSSP_NO_PRED;
+		i = res->preds[i])
+		if (!path_queue_push(path, res->vertices[i]->content, 1))
+			return (NULL);
+	if (!path_queue_push(path, res->vertices[i]->content, 1))
+		return (NULL);
+	return (path);
+}
@@ -0,0 +1,174 @@
+#include "bench_graph.h"
+
+/*
+ * Times a_star_graph_r, driven by the indexed heap, against the former
+ * recursive_a_star, which rescanned every f_score and walked the vertex
+ * list to pick each vertex to expand, on 8-connected grids of 10k to 2M
+ * vertices, searching from a corner to the opposite one. Both use the
+ * default heuristic h(). The former search is O(V^2), so it only runs up
+ * to the size given as first argument (100000 by default); its tail
+ * recursion is written as a loop so that it does not overflow the call
+ * stack first. Build it from pathfinding/ with every source of the
+ * directory, the bench_graph sources of tests/ and the queues library:
+ * gcc -O2 -Wall -Wextra -pedantic -std=gnu89 -I. tests/a_star_bench.c
+ *	tests/bench_graph.c tests/bench_graph_gen.c [sources] -lqueues
+ */
+
+/**
+ * legacy_min - get_min_g_score, the former pick of the vertex to expand
+ * @graph: pointer to graph
+ * @f_score: array of f_scores
+ * @visited: array of if vertex has been visited
+ * Return: vertex with minimum f_score or NULL
+ */
+vertex_t *legacy_min(graph_t *graph, size_t *f_score, size_t *visited)
+{
+	size_t min = ULONG_MAX, index = ULONG_MAX, i;
+	vertex_t *vertex = graph->vertices;
+
+	for (i = 0; i < graph->nb_vertices; i++)
+		if (visited[i] == 0 && min > f_score[i])
+			min = f_score[i], index = i;
+	if (index == ULONG_MAX)
+		return (NULL);
+	while (vertex->next && vertex->index != index)
+		vertex = vertex->next;
+	return (vertex);
+}
+
+/**
+ * legacy_search - recursive_a_star without its trace, as a loop
+ * @graph: pointer to graph to go through
+ * @scores: g_scores of the vertices, followed by their f_scores
+ * @visited: keeps track of which vertices have been visited
+ * @came_from: keeps track of came_from nodes for each vertex
+ * @target: pointer to target vertex
+ */
+void legacy_search(graph_t *graph, size_t *scores, size_t *visited,
+	vertex_t **came_from, vertex_t const *target)
+{
+	size_t *g_score = scores, *f_score = scores + graph->nb_vertices;
+	size_t i, g;
+	vertex_t *current;
+	edge_t *edge;
+
+	while (!visited[target->index])
+	{
+		current = legacy_min(graph, f_score, visited);
+		if (!current)
+			return;
+		i = current->index;
+		f_score[i] = h(current->x, current->y, target->x, target->y);
+		for (edge = current->edges; edge; edge = edge->next)
+		{
+			g = g_score[i] + edge->weight;
+			if (g_score[edge->dest->index] <= g)
+				continue;
+			came_from[edge->dest->index] = current;
+			g_score[edge->dest->index] = g;
+			f_score[edge->dest->index] = g + h(edge->dest->x,
+				edge->dest->y, target->x, target->y);
+		}
+		visited[i] = 1;
+	}
+}
+
+/**
+ * legacy_a_star - the former a_star_graph, without its trace
+ * @graph: pointer to graph to go through
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+queue_t *legacy_a_star(graph_t *graph, vertex_t const *start,
+	vertex_t const *target)
+{
+	size_t n = graph->nb_vertices, i;
+	size_t *visited = calloc(n, sizeof(*visited));
+	size_t *scores = malloc(2 * n * sizeof(*scores));
+	vertex_t **came_from = calloc(n, sizeof(*came_from));
+	queue_t *path = queue_create();
+
+	if (visited && scores && came_from && path)
+	{
+		for (i = 0; i < 2 * n; i++)
+			scores[i] = ULONG_MAX;
+		scores[start->index] = 0;
+		scores[n + start->index] = h(start->x, start->y,
+			target->x, target->y);
+		legacy_search(graph, scores, visited, came_from, target);
+	}
+	if (path && came_from && came_from[target->index])
+		for (queue_push_front(path, strdup(target->content)),
+			i = target->index; i != start->index;
+			i = came_from[i]->index)
+			queue_push_front(path, strdup(came_from[i]->content));
+	else if (path)
+		path = (free(path), NULL);
+	free(visited), free(scores), free(came_from);
+	return (path);
+}
+
+/**
+ * bench_size - times both searches on one grid and prints a row
+ * @ctx: query context of the heap search
+ * @side: number of rows and columns of the grid
+ * @legacy_max: largest number of vertices the former search runs on
+ * Return: 1 if the searches agree or the former one was skipped, 0
+ * otherwise
+ */
+int bench_size(dijkstra_ctx_t *ctx, int side, size_t legacy_max)
+{
+	bench_graph_t *bg = bench_grid(side, side, 1, 4);
+	vertex_t *start, *target;
+	queue_t *heap_path, *legacy_path = NULL;
+	double t0, t_heap, t_legacy = -1;
+
+	if (!bg)
+		return (0);
+	start = &bg->vertices[0];
+	target = &bg->vertices[bg->graph.nb_vertices - 1];
+	t0 = bench_now();
+	heap_path = a_star_graph_r(ctx, &bg->graph, start, target);
+	t_heap = bench_now() - t0;
+	if (bg->graph.nb_vertices <= legacy_max)
+	{
+		t0 = bench_now();
+		legacy_path = legacy_a_star(&bg->graph, start, target);
+		t_legacy = bench_now() - t0;
+	}
+	printf("%9lu %9lu %12.1f", (unsigned long)bg->graph.nb_vertices,
+		(unsigned long)ctx->nb_expanded, t_heap * 1000);
+	if (t_legacy < 0)
+		printf(" %12s %9s\n", "skipped", "-");
+	else
+		printf(" %12.1f %8.1fx\n", t_legacy * 1000, t_legacy / t_heap);
+	bench_graph_delete(bg);
+	if (t_legacy < 0)
+		return (same_path(heap_path, NULL), 1);
+	return (same_path(heap_path, legacy_path));
+}
+
+/**
+ * main - runs the benchmark
+ * @ac: number of arguments
+ * @av: arguments, the optional largest size the former search runs on
+ * Return: EXIT_SUCCESS if both searches found the same paths
+ */
+int main(int ac, char **av)
+{
+	static int const sides[] = {100, 316, 1000, 1415};
+	dijkstra_ctx_t *ctx = dijkstra_ctx_create();
+	size_t legacy_max = ac > 1 ? strtoul(av[1], NULL, 10) : 100000;
+	size_t i;
+	int ok = ctx != NULL;
+
+	printf("%9s %9s %12s %12s %9s\n", "vertices", "expanded",
+		"heap (ms)", "former (ms)", "speedup");
+	for (i = 0; ok && i < sizeof(sides) / sizeof(*sides); i++)
+		ok = bench_size(ctx, sides[i], legacy_max);
+	dijkstra_ctx_delete(ctx);
+	if (!ok)
+		printf("the searches disagree\n");
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,110 @@
+#include "bench_graph.h"
+
+/**
+ * bench_now - reads a monotonic clock
+ * Return: the time in seconds
+ */
+double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * bench_graph_alloc - allocates a graph of vertices without edges
+ * Vertex i is named after i and linked after vertex i - 1
+ * @nb_vertices: number of vertices
+ * @nb_edges: number of edges the graph can hold
+ * Return: pointer to the graph, NULL on failure
+ */
+bench_graph_t *bench_graph_alloc(size_t nb_vertices, size_t nb_edges)
+{
+	bench_graph_t *bg = calloc(1, sizeof(*bg));
+	size_t i;
+
+	if (!bg)
+		return (NULL);
+	bg->vertices = calloc(nb_vertices + 1, sizeof(*bg->vertices));
+	bg->edges = malloc((nb_edges + 1) * sizeof(*bg->edges));
+	bg->names = malloc(nb_vertices * BENCH_NAME_SIZE + 1);
+	if (!bg->vertices || !bg->edges || !bg->names)
+	{
+		bench_graph_delete(bg);
+		return (NULL);
+	}
+	for (i = 0; i < nb_vertices; i++)
+	{
+		bg->vertices[i].index = i;
+		bg->vertices[i].content = bg->names + i * BENCH_NAME_SIZE;
+		sprintf(bg->vertices[i].content, "%lu", (unsigned long)i);
+		bg->vertices[i].next = i + 1 < nb_vertices ?
+			&bg->vertices[i + 1] : NULL;
+	}
+	bg->graph.nb_vertices = nb_vertices;
+	bg->graph.vertices = nb_vertices ? bg->vertices : NULL;
+	return (bg);
+}
+
+/**
+ * bench_graph_delete - deallocates a generated graph
+ * @bg: pointer to the graph, may be NULL
+ */
+void bench_graph_delete(bench_graph_t *bg)
+{
+	if (!bg)
+		return;
+	free(bg->vertices);
+	free(bg->edges);
+	free(bg->names);
+	free(bg);
+}
+
+/**
+ * bench_edge - appends an edge to the edge list of a vertex
+ * Edges are added vertex by vertex, so the last edge of the block is the
+ * last one of the list of @src when it is not the first
+ * @bg: pointer to the graph, with room for one more edge
+ * @src: index of the vertex the edge leaves
+ * @dest: index of the vertex the edge reaches
+ * @weight: weight of the edge
+ */
+void bench_edge(bench_graph_t *bg, size_t src, size_t dest, int weight)
+{
+	edge_t *edge = &bg->edges[bg->nb_edges++];
+	vertex_t *v = &bg->vertices[src];
+
+	edge->dest = &bg->vertices[dest];
+	edge->weight = weight;
+	edge->next = NULL;
+	if (v->edges)
+		edge[-1].next = edge;
+	else
+		v->edges = edge;
+	v->nb_edges++;
+}
+
+/**
+ * same_path - compares and frees two path queues
+ * @a: first queue, may be NULL
+ * @b: second queue, may be NULL
+ * Return: 1 if both hold the same names, 0 otherwise
+ */
+int same_path(queue_t *a, queue_t *b)
+{
+	char *x = NULL, *y = NULL;
+	int same = !a == !b;
+
+	while (a && b && (x = dequeue(a), y = dequeue(b), x || y))
+	{
+		same = same && x && y && !strcmp(x, y);
+		free(x), free(y);
+	}
+	while (a && (x = dequeue(a)))
+		free(x);
+	while (b && (x = dequeue(b)))
+		free(x);
+	free(a), free(b);
+	return (same);
+}
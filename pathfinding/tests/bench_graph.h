@@ -0,0 +1,54 @@
+#ifndef BENCH_GRAPH_H
+#define BENCH_GRAPH_H
+
+#include "../pathfinding.h"
+#include <time.h>
+
+/**
+* struct bench_graph_s - Generated graph whose vertices, edges and names
+* live in three blocks, so that graphs of millions of vertices are built
+* in linear time without graph_add_vertex and graph_add_edge
+*
+* @graph: Graph handed to the searches
+*
+* @vertices: Vertices, @vertices[i] having index i
+*
+* @edges: Edges of every vertex
+*
+* @nb_edges: Number of edges of @edges in use
+*
+* @names: Names of the vertices, their index in decimal
+*/
+typedef struct bench_graph_s
+{
+	graph_t graph;
+
+	vertex_t *vertices;
+
+	edge_t *edges;
+
+	size_t nb_edges;
+
+	char *names;
+
+} bench_graph_t;
+
+#define BENCH_NAME_SIZE 24
+
+double bench_now(void);
+
+bench_graph_t *bench_graph_alloc(size_t nb_vertices, size_t nb_edges);
+
+void bench_graph_delete(bench_graph_t *bg);
+
+void bench_edge(bench_graph_t *bg, size_t src, size_t dest, int weight);
+
+int same_path(queue_t *a, queue_t *b);
+
+bench_graph_t *bench_grid(int cols, int rows, int diagonal, int jitter);
+
+bench_graph_t *bench_random(size_t nb_vertices, size_t degree,
+
+	int max_weight);
+
+#endif /* BENCH_GRAPH_H */
@@ -0,0 +1,79 @@
+#include "bench_graph.h"
+
+/**
+ * bench_grid - generates a grid graph, each cell linked both ways to its
+ * 4 or 8 neighbors
+ * Cell (x, y) has index y * @cols + x and coordinates (x, y). A straight
+ * move weighs 10 and a diagonal one 14, plus up to @jitter, so that the
+ * built-in heuristics given a cost of 10 stay admissible, but for
+ * Manhattan and Euclidean on an 8-connected grid
+ * @cols: number of columns
+ * @rows: number of rows
+ * @diagonal: whether diagonal moves are allowed
+ * @jitter: largest random extra weight of a move, 0 for none
+ * Return: pointer to the graph, NULL on failure
+ */
+bench_graph_t *bench_grid(int cols, int rows, int diagonal, int jitter)
+{
+	static int const dx[] = {1, 0, -1, 0, 1, -1, -1, 1};
+	static int const dy[] = {0, 1, 0, -1, 1, 1, -1, -1};
+	bench_graph_t *bg;
+	int x, y, k, nx, ny, weight;
+
+	bg = bench_graph_alloc((size_t)cols * rows,
+		(size_t)cols * rows * (diagonal ? 8 : 4));
+	if (!bg)
+		return (NULL);
+	srand(cols * 31 + rows);
+	for (y = 0; y < rows; y++)
+		for (x = 0; x < cols; x++)
+		{
+			bg->vertices[(size_t)y * cols + x].x = x;
+			bg->vertices[(size_t)y * cols + x].y = y;
+			for (k = 0; k < (diagonal ? 8 : 4); k++)
+			{
+				nx = x + dx[k], ny = y + dy[k];
+				if (nx < 0 || nx >= cols ||
+					ny < 0 || ny >= rows)
+					continue;
+				weight = k < 4 ? 10 : 14;
+				if (jitter)
+					weight += rand() % (jitter + 1);
+				bench_edge(bg, (size_t)y * cols + x,
+					(size_t)ny * cols + nx, weight);
+			}
+		}
+	return (bg);
+}
+
+/**
+ * bench_random - generates a random sparse graph
+ * Each vertex gets @degree edges towards random vertices, plus one
+ * towards the next vertex so that every vertex is reachable from 0
+ * @nb_vertices: number of vertices
+ * @degree: number of random edges of each vertex
+ * @max_weight: largest weight of an edge, weights starting at 1
+ * Return: pointer to the graph, NULL on failure
+ */
+bench_graph_t *bench_random(size_t nb_vertices, size_t degree,
+	int max_weight)
+{
+	bench_graph_t *bg;
+	size_t i, k;
+
+	bg = bench_graph_alloc(nb_vertices, nb_vertices * (degree + 1));
+	if (!bg)
+		return (NULL);
+	srand(nb_vertices);
+	for (i = 0; i < nb_vertices; i++)
+	{
+		bg->vertices[i].x = rand() % 1000;
+		bg->vertices[i].y = rand() % 1000;
+		for (k = 0; k < degree; k++)
+			bench_edge(bg, i, (size_t)rand() % nb_vertices,
+				1 + rand() % max_weight);
+		if (i + 1 < nb_vertices)
+			bench_edge(bg, i, i + 1, 1 + rand() % max_weight);
+	}
+	return (bg);
+}
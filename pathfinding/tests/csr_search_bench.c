@@ -0,0 +1,105 @@
+#include "bench_graph.h"
+
+/*
+ * Times dijkstra_graph_r and a_star_graph_r on a graph_t against
+ * csr_dijkstra_graph and csr_a_star_graph on a graph_freeze snapshot of
+ * it, on 8-connected grids of 250k and 1M vertices, and checks that both
+ * forms return the same paths. The generated graph_t keeps its vertices
+ * and edges in contiguous blocks, so the linked form is timed at its
+ * best; graphs built with graph_add_vertex scatter them over the heap.
+ * Build it from pathfinding/ with every source of the directory, the
+ * bench_graph sources of tests/ and the queues library:
+ * gcc -O2 -Wall -Wextra -pedantic -std=gnu89 -I. tests/csr_search_bench.c
+ *	tests/bench_graph.c tests/bench_graph_gen.c [sources] -lqueues
+ */
+
+#define NB_QUERIES 8
+
+/**
+ * time_search - times NB_QUERIES searches of one kind
+ * @which: 0 for dijkstra_graph_r, 1 for csr_dijkstra_graph, 2 for
+ *   a_star_graph_r, 3 for csr_a_star_graph
+ * @ctx: query context
+ * @bg: graph to search
+ * @csr: snapshot of @bg
+ * @paths: where to store the path of each query
+ * Return: the time taken in milliseconds
+ */
+double time_search(int which, dijkstra_ctx_t *ctx, bench_graph_t *bg,
+	csr_graph_t const *csr, queue_t **paths)
+{
+	size_t n = bg->graph.nb_vertices, q;
+	graph_t const *graph = &bg->graph;
+	vertex_t *start, *target;
+	double t0 = bench_now();
+
+	for (q = 0; q < NB_QUERIES; q++)
+	{
+		start = &bg->vertices[q * 7919 % n];
+		target = &bg->vertices[n - 1 - q * 104729 % n];
+		if (which == 0)
+			paths[q] = dijkstra_graph_r(ctx, graph, start, target);
+		else if (which == 1)
+			paths[q] = csr_dijkstra_graph(ctx, csr, start, target);
+		else if (which == 2)
+			paths[q] = a_star_graph_r(ctx, graph, start, target);
+		else
+			paths[q] = csr_a_star_graph(ctx, csr, start, target);
+	}
+	return ((bench_now() - t0) * 1000);
+}
+
+/**
+ * bench_size - times every search on one grid and prints a row
+ * @ctx: query context
+ * @side: number of rows and columns of the grid
+ * Return: 1 if both forms agree, 0 otherwise
+ */
+int bench_size(dijkstra_ctx_t *ctx, int side)
+{
+	bench_graph_t *bg = bench_grid(side, side, 1, 4);
+	csr_graph_t *csr;
+	queue_t *paths[4][NB_QUERIES];
+	double t[5], t0;
+	int i, q, same = 1;
+
+	if (!bg)
+		return (0);
+	t0 = bench_now();
+	csr = graph_freeze(&bg->graph);
+	t[0] = (bench_now() - t0) * 1000;
+	if (!csr)
+		return (bench_graph_delete(bg), 0);
+	for (i = 0; i < 4; i++)
+		t[i + 1] = time_search(i, ctx, bg, csr, paths[i]);
+	printf("%9lu %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+		(unsigned long)bg->graph.nb_vertices, t[0], t[1], t[2], t[3],
+		t[4]);
+	for (q = 0; q < NB_QUERIES; q++)
+		same = same_path(paths[0][q], paths[1][q]) &&
+			same_path(paths[2][q], paths[3][q]) && same;
+	csr_graph_delete(csr);
+	bench_graph_delete(bg);
+	return (same);
+}
+
+/**
+ * main - runs the benchmark
+ * Return: EXIT_SUCCESS if both forms agree on every query
+ */
+int main(void)
+{
+	static int const sides[] = {500, 1000};
+	dijkstra_ctx_t *ctx = dijkstra_ctx_create();
+	size_t i;
+	int ok = ctx != NULL;
+
+	printf("%9s %10s %10s %10s %10s %10s\n", "vertices", "freeze",
+		"dijkstra", "csr dijk.", "a*", "csr a*");
+	for (i = 0; ok && i < sizeof(sides) / sizeof(*sides); i++)
+		ok = bench_size(ctx, sides[i]);
+	dijkstra_ctx_delete(ctx);
+	printf(ok ? "times in ms for %d queries\n" : "the searches disagree\n",
+		NB_QUERIES);
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
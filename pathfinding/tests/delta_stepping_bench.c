@@ -0,0 +1,118 @@
+#include "bench_graph.h"
+
+/*
+ * Times delta_stepping with 1 to 32 threads against
+ * dijkstra_one_to_many_r from the same source, on a random graph and an
+ * 8-connected grid of 1M vertices, and checks that every run finds the
+ * same distances and predecessors as Dijkstra. The speedup column is
+ * relative to one thread; it can only exceed 1 on a machine with as
+ * many cores. Build it from pathfinding/ with every source of the
+ * directory, the bench_graph sources of tests/ and the queues library:
+ * gcc -O2 -Wall -Wextra -pedantic -std=gnu89 -I. tests/delta_stepping_bench.c
+ *	tests/bench_graph.c tests/bench_graph_gen.c [sources] -lqueues -pthread
+ */
+
+/**
+ * same_sssp - compares two single-source results
+ * @a: first result
+ * @b: second result
+ * Return: 1 if both hold the same distances and predecessors, 0 otherwise
+ */
+int same_sssp(sssp_t const *a, sssp_t const *b)
+{
+	size_t n;
+
+	if (!a || !b || a->nb_vertices != b->nb_vertices)
+		return (0);
+	n = a->nb_vertices;
+	return (!memcmp(a->dists, b->dists, n * sizeof(*a->dists)) &&
+		!memcmp(a->preds, b->preds, n * sizeof(*a->preds)));
+}
+
+/**
+ * time_threads - times delta_stepping with 1, 2, 4, 8, 16 and 32 threads
+ * and prints a row for each
+ * @csr: snapshot of the graph
+ * @rev: transposed snapshot of the graph
+ * @delta: width of a bucket
+ * @expected: result of Dijkstra from vertex 0
+ * Return: 1 if every run matches @expected, 0 otherwise
+ */
+int time_threads(csr_graph_t const *csr, csr_graph_t const *rev,
+	int delta, sssp_t const *expected)
+{
+	sssp_t *res;
+	size_t nb_threads;
+	double t0, t, t_one = 0;
+	int ok = 1;
+
+	for (nb_threads = 1; ok && nb_threads <= 32; nb_threads *= 2)
+	{
+		t0 = bench_now();
+		res = delta_stepping(csr, rev, 0, delta, nb_threads);
+		t = bench_now() - t0;
+		if (nb_threads == 1)
+			t_one = t;
+		ok = same_sssp(res, expected);
+		printf("%-14s %8lu %12.1f %8.2fx\n", "delta-stepping",
+			(unsigned long)nb_threads, t * 1000, t_one / t);
+		sssp_delete(res);
+	}
+	return (ok);
+}
+
+/**
+ * bench_kind - times Dijkstra and delta_stepping on one graph
+ * @ctx: query context of Dijkstra
+ * @bg: graph to search, deleted before returning
+ * @name: description of the graph
+ * @delta: width of a bucket
+ * Return: 1 if every run matches Dijkstra, 0 otherwise
+ */
+int bench_kind(dijkstra_ctx_t *ctx, bench_graph_t *bg, char const *name,
+	int delta)
+{
+	csr_graph_t *csr = NULL, *rev = NULL;
+	sssp_t *expected = NULL;
+	double t0;
+	int ok = bg != NULL;
+
+	if (ok)
+	{
+		printf("%s, delta %d\n", name, delta);
+		t0 = bench_now();
+		expected = dijkstra_one_to_many_r(ctx, &bg->graph,
+			&bg->vertices[0], NULL, 0);
+		printf("%-14s %8s %12.1f\n", "dijkstra", "-",
+			(bench_now() - t0) * 1000);
+		csr = graph_freeze(&bg->graph);
+		rev = csr ? csr_transpose(csr) : NULL;
+		ok = expected && rev;
+	}
+	ok = ok && time_threads(csr, rev, delta, expected);
+	sssp_delete(expected);
+	csr_graph_delete(csr), csr_graph_delete(rev);
+	bench_graph_delete(bg);
+	return (ok);
+}
+
+/**
+ * main - runs the benchmark
+ * Return: EXIT_SUCCESS if every run matches Dijkstra
+ */
+int main(void)
+{
+	dijkstra_ctx_t *ctx = dijkstra_ctx_create();
+	int ok = ctx != NULL;
+
+	printf("%-14s %8s %12s %9s\n", "search", "threads", "time (ms)",
+		"speedup");
+	ok = ok && bench_kind(ctx, bench_random(1000000, 4, 100),
+		"random graph of 1M vertices, weights 1 to 100", 50);
+	ok = ok && bench_kind(ctx, bench_grid(1000, 1000, 1, 4),
+		"8-connected grid of 1M vertices", 18);
+	dijkstra_ctx_delete(ctx);
+	if (!ok)
+		printf("delta-stepping and Dijkstra disagree\n");
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,145 @@
+#include "bench_graph.h"
+
+/*
+ * Times dijkstra_graph_r, driven by the indexed heap, against the linear
+ * scan dijkstra_graph used before it, on grids of 10k, 100k and 1M
+ * vertices, searching from a corner to the opposite one. The scan is
+ * O(V^2), so it only runs up to the size given as first argument
+ * (100000 by default). Build it from pathfinding/ with every source of
+ * the directory and of tests/ but the other benchmarks, plus the queues
+ * library the project links against:
+ * gcc -O2 -Wall -Wextra -pedantic -std=gnu89 -I. tests/dijkstra_bench.c
+ *	tests/bench_graph.c tests/bench_graph_gen.c [sources] -lqueues
+ */
+
+/**
+ * scan_search - the linear scan search of the former dijkstra_graph,
+ * without its trace
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * @from: where to store the vertex each vertex is reached from
+ * @verts: where to store the vertex of each index
+ * Return: index of @target if it was reached, -1 otherwise
+ */
+long scan_search(graph_t *graph, vertex_t const *start,
+	vertex_t const *target, vertex_t **from, vertex_t **verts)
+{
+	long i, d, j = -1;
+	int *dists = calloc(graph->nb_vertices, sizeof(*dists));
+	vertex_t *v;
+	edge_t *e;
+
+	if (!dists)
+		return (-1);
+	for (v = graph->vertices; v; v = v->next)
+		verts[v->index] = v, dists[v->index] = INT_MAX;
+	dists[start->index] = 0, from[start->index] = NULL;
+	while (j != (long)target->index)
+	{
+		for (d = INT_MAX, j = -1, i = 0;
+			i < (long)graph->nb_vertices; i++)
+			if (dists[i] >= 0 && dists[i] < d)
+				d = dists[i], j = i;
+		if (j == -1)
+			break;
+		for (e = verts[j]->edges; e; e = e->next)
+			if (dists[e->dest->index] >= 0 &&
+				dists[j] + e->weight < dists[e->dest->index])
+				dists[e->dest->index] = dists[j] + e->weight,
+					from[e->dest->index] = verts[j];
+		dists[j] = -1;
+	}
+	free(dists);
+	return (j);
+}
+
+/**
+ * scan_dijkstra - the former dijkstra_graph, without its trace
+ * @graph: pointer to graph struct
+ * @start: pointer to starting vertex
+ * @target: pointer to target vertex
+ * Return: path queue or NULL
+ */
+queue_t *scan_dijkstra(graph_t *graph, vertex_t const *start,
+	vertex_t const *target)
+{
+	vertex_t **from = calloc(graph->nb_vertices, sizeof(*from));
+	vertex_t **verts = calloc(graph->nb_vertices, sizeof(*verts));
+	queue_t *path = queue_create();
+	long j = -1;
+
+	if (from && verts && path)
+		j = scan_search(graph, start, target, from, verts);
+	if (j != -1)
+		for (queue_push_front(path, strdup(verts[j]->content));
+			j != (long)start->index; j = from[j]->index)
+			queue_push_front(path, strdup(from[j]->content));
+	else if (path)
+		path = (free(path), NULL);
+	free(from), free(verts);
+	return (path);
+}
+
+/**
+ * bench_size - times both searches on one grid and prints a row
+ * @ctx: query context of the heap search
+ * @side: number of rows and columns of the grid
+ * @scan_max: largest number of vertices the scan runs on
+ * Return: 1 if the searches agree or the scan was skipped, 0 otherwise
+ */
+int bench_size(dijkstra_ctx_t *ctx, int side, size_t scan_max)
+{
+	bench_graph_t *bg = bench_grid(side, side, 0, 9);
+	vertex_t *start, *target;
+	queue_t *heap_path, *scan_path = NULL;
+	double t0, t_heap, t_scan = -1;
+
+	if (!bg)
+		return (0);
+	start = &bg->vertices[0];
+	target = &bg->vertices[bg->graph.nb_vertices - 1];
+	t0 = bench_now();
+	heap_path = dijkstra_graph_r(ctx, &bg->graph, start, target);
+	t_heap = bench_now() - t0;
+	if (bg->graph.nb_vertices <= scan_max)
+	{
+		t0 = bench_now();
+		scan_path = scan_dijkstra(&bg->graph, start, target);
+		t_scan = bench_now() - t0;
+	}
+	printf("%9lu %12.1f", (unsigned long)bg->graph.nb_vertices,
+		t_heap * 1000);
+	if (t_scan < 0)
+		printf(" %12s %8s\n", "skipped", "-");
+	else
+		printf(" %12.1f %8.1fx\n", t_scan * 1000, t_scan / t_heap);
+	bench_graph_delete(bg);
+	if (t_scan < 0)
+		return (same_path(heap_path, NULL), 1);
+	return (same_path(heap_path, scan_path));
+}
+
+/**
+ * main - runs the benchmark
+ * @ac: number of arguments
+ * @av: arguments, the optional largest size the scan runs on
+ * Return: EXIT_SUCCESS if both searches found the same paths
+ */
+int main(int ac, char **av)
+{
+	static int const sides[] = {100, 316, 1000};
+	dijkstra_ctx_t *ctx = dijkstra_ctx_create();
+	size_t scan_max = ac > 1 ? strtoul(av[1], NULL, 10) : 100000;
+	size_t i;
+	int ok = ctx != NULL;
+
+	printf("%9s %12s %12s %9s\n", "vertices", "heap (ms)", "scan (ms)",
+		"speedup");
+	for (i = 0; ok && i < sizeof(sides) / sizeof(*sides); i++)
+		ok = bench_size(ctx, sides[i], scan_max);
+	dijkstra_ctx_delete(ctx);
+	if (!ok)
+		printf("the searches disagree\n");
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
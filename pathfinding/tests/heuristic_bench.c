@@ -0,0 +1,138 @@
+#include "bench_graph.h"
+
+/*
+ * Runs a_star_search with every heuristic on a 4-connected and an
+ * 8-connected grid of 1M vertices, whose moves weigh 10 and 14 plus up
+ * to 4, and prints the vertices expanded and the time taken by each. The
+ * user callback returns 0, which makes A* expand like Dijkstra. Every
+ * heuristic is given the costs of the grid. Manhattan and Euclidean only
+ * run on the 4-connected grid: on the other one a diagonal move of 14
+ * is cheaper than 10 * sqrt(2), so they overestimate and A* may return
+ * longer paths. Every row must find paths of the same cost. Build it
+ * from pathfinding/ with every source of the directory, the bench_graph
+ * sources of tests/ and the queues library:
+ * gcc -O2 -Wall -Wextra -pedantic -std=gnu89 -I. tests/heuristic_bench.c
+ *	tests/bench_graph.c tests/bench_graph_gen.c [sources] -lqueues
+ */
+
+#define NB_QUERIES 4
+#define NB_HEURISTICS 6
+
+/**
+ * heuristic_zero - user callback estimating every cost as 0
+ * @v: vertex to estimate from
+ * @target: target vertex
+ * @param: unused
+ * Return: 0
+ */
+size_t heuristic_zero(vertex_t const *v, vertex_t const *target,
+	void const *param)
+{
+	(void)v, (void)target, (void)param;
+	return (0);
+}
+
+/**
+ * use_heuristic - selects one of the heuristics benchmarked
+ * @ctx: query context to select it in
+ * @k: number of the heuristic, below NB_HEURISTICS
+ * @diagonal: whether the grid is 8-connected
+ * Return: name of the heuristic, NULL if it is not admissible on the grid
+ */
+char const *use_heuristic(dijkstra_ctx_t *ctx, int k, int diagonal)
+{
+	static size_t const unit = 10;
+	static octile_cost_t const octile = {10, 14};
+	static heuristic_type_t const types[] = {HEURISTIC_EUCLIDEAN,
+		HEURISTIC_MANHATTAN, HEURISTIC_OCTILE, HEURISTIC_CHEBYSHEV};
+	static char const * const names[] = {"zero callback", "h()",
+		"euclidean", "manhattan", "octile", "chebyshev"};
+
+	if ((k == 2 || k == 3) && diagonal)
+		return (NULL);
+	ctx->heuristic = k == 0 ? heuristic_zero :
+		k == 1 ? NULL : heuristic_get(types[k - 2]);
+	ctx->heuristic_param = k == 4 ? (void const *)&octile :
+		(void const *)&unit;
+	return (names[k]);
+}
+
+/**
+ * time_heuristic - runs NB_QUERIES searches with the heuristic selected
+ * and prints a row
+ * @ctx: query context
+ * @bg: graph to search
+ * @name: name of the heuristic
+ * Return: total cost of the paths found
+ */
+long time_heuristic(dijkstra_ctx_t *ctx, bench_graph_t *bg,
+	char const *name)
+{
+	size_t n = bg->graph.nb_vertices, expanded = 0, q;
+	vertex_t *start, *target;
+	long cost = 0;
+	double t0 = bench_now(), t;
+
+	for (q = 0; q < NB_QUERIES; q++)
+	{
+		start = &bg->vertices[q * 7919 % n];
+		target = &bg->vertices[n - 1 - q * 104729 % n];
+		if (a_star_search(ctx, &bg->graph, start, target) != 1)
+			return (-1);
+		cost += dijkstra_dist(ctx, target->index);
+		expanded += ctx->nb_expanded;
+	}
+	t = bench_now() - t0;
+	printf("%-14s %12lu %12.1f %10ld\n", name, (unsigned long)expanded,
+		t * 1000, cost);
+	return (cost);
+}
+
+/**
+ * bench_kind - runs every heuristic admissible on one grid
+ * @ctx: query context
+ * @side: number of rows and columns of the grid
+ * @diagonal: whether the grid is 8-connected
+ * Return: 1 if every heuristic found paths of the same cost, 0 otherwise
+ */
+int bench_kind(dijkstra_ctx_t *ctx, int side, int diagonal)
+{
+	bench_graph_t *bg = bench_grid(side, side, diagonal, 4);
+	char const *name;
+	long cost, first = -1;
+	int k, ok = bg != NULL;
+
+	if (ok)
+		printf("%d-connected grid of %lu vertices\n", diagonal ? 8 : 4,
+			(unsigned long)bg->graph.nb_vertices);
+	for (k = 0; ok && k < NB_HEURISTICS; k++)
+	{
+		name = use_heuristic(ctx, k, diagonal);
+		if (!name)
+			continue;
+		cost = time_heuristic(ctx, bg, name);
+		if (first == -1)
+			first = cost;
+		ok = cost != -1 && cost == first;
+	}
+	bench_graph_delete(bg);
+	return (ok);
+}
+
+/**
+ * main - runs the benchmark
+ * Return: EXIT_SUCCESS if every heuristic found paths of the same cost
+ */
+int main(void)
+{
+	dijkstra_ctx_t *ctx = dijkstra_ctx_create();
+	int ok = ctx != NULL;
+
+	printf("%-14s %12s %12s %10s\n", "heuristic", "expanded",
+		"time (ms)", "cost");
+	ok = ok && bench_kind(ctx, 1000, 0) && bench_kind(ctx, 1000, 1);
+	dijkstra_ctx_delete(ctx);
+	printf(ok ? "totals over %d queries\n" :
+		"the heuristics disagree\n", NB_QUERIES);
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}